@@ -3,40 +3,36 @@
 
 #include <vector>
 #include <memory>
-#include <map>
 #include <SFML/Graphics.hpp>
 #include "Tiles/Tiles.h"
+#include "Tile_Grid.h"
+#include "Arena_Renderer.h"
 
+// Render side of the arena. The grid itself belongs to the Simulation; the
+// arena only reads its tile types once and then follows the claims it is fed.
 class Arena {
 private:
     static std::unique_ptr<Arena> instance;
-    explicit Arena(sf::Texture& texture);
-    Arena();
-    static const int GridSize;
-    const float teleporterTileProb;
-    const float damageTileProb;
-    const float stickyTileProb;
-    const float healingTileProb;
-    const float superTileProb;
+    Arena(sf::Texture& texture, const sf::IntRect& tileRegion);
+    Arena() = default;
 
-    std::vector<std::vector<std::unique_ptr<Tile>>> Grid;
-
-    float Probability();
+    Arena_Renderer renderer;
 
 public:
     Arena(const Arena&) = delete;
     Arena& operator=(const Arena&) = delete;
     Arena(const Arena&&) = delete;
     Arena& operator=(const Arena&&) = delete;
-    static Arena& getInstance();
-    static Arena& getInstance(sf::Texture& texture);
-
-    static int GetGridSize();
-    std::vector<std::vector<std::unique_ptr<Tile>>>& GetGrid();
 
-    std::map<int, int> getPlayerTileCounts() const;
-
-    void draw(sf::RenderWindow& window, int perspectivaPlayerID);
+    static Arena& getInstance();
+    static Arena& getInstance(sf::Texture& texture, const sf::IntRect& tileRegion = {});
+
+    // Build once before drawing, then feed it the changes.
+    void prepareRenderer(const Tile_Grid& grid);
+    void applyTileChanges(const std::vector<Tile_Change>& changes);
+    void beginFrame();
+    void endFrame();
+    void draw(sf::RenderWindow& window, int perspectivaPlayerID, Cull_Stats* stats = nullptr);
 };
 
-#endif // ARENA_H
\ No newline at end of file
+#endif // ARENA_H
@@ -0,0 +1,240 @@
+#include "Arena_Renderer.h"
+
+#include <algorithm>
+#include <cmath>
+
+Arena_Renderer::Arena_Renderer(const sf::Texture* tileTexture, const sf::IntRect& tileRegion) :
+    texture(tileTexture),
+    textureRegion(tileRegion) {
+    if (texture && textureRegion.size == sf::Vector2i(0, 0)) {
+        textureRegion = sf::IntRect({0, 0}, sf::Vector2i(texture->getSize()));
+    }
+}
+
+void Arena_Renderer::build(const Tile_Grid& tileGrid) {
+    grid = &tileGrid;
+    columns = tileGrid.getWidth();
+    rows = tileGrid.getHeight();
+    chunkColumns = (columns + ChunkTiles - 1) / ChunkTiles;
+    claims.clear();
+    cache.clear();
+}
+
+std::size_t Arena_Renderer::chunkOf(std::size_t tileIndex, std::size_t& slot) const {
+    int x = static_cast<int>(tileIndex % columns);
+    int y = static_cast<int>(tileIndex / columns);
+    slot = static_cast<std::size_t>(y % ChunkTiles) * ChunkTiles + x % ChunkTiles;
+    return static_cast<std::size_t>(y / ChunkTiles) * chunkColumns + x / ChunkTiles;
+}
+
+void Arena_Renderer::setTileColor(Chunk_Cache& chunk, std::size_t slot, sf::Color color) {
+    sf::Vertex* quad = &chunk.vertices[slot * VerticesPerTile];
+    for (std::size_t k = 0; k < VerticesPerTile; ++k) {
+        quad[k].color = color;
+    }
+}
+
+void Arena_Renderer::buildChunkVertices(int chunkX, int chunkY, Chunk_Cache& chunk) {
+    float tileSize = Tile::getSize();
+    sf::Vector2f texMin = sf::Vector2f(textureRegion.position);
+    sf::Vector2f texMax = texMin + sf::Vector2f(textureRegion.size);
+    int minX = chunkX * ChunkTiles;
+    int minY = chunkY * ChunkTiles;
+
+    auto found = claims.find(static_cast<std::size_t>(chunkY) * chunkColumns + chunkX);
+    const Chunk_Claims* chunkClaims = found != claims.end() ? &found->second : nullptr;
+
+    // Slots outside the map on the last row/column of chunks stay degenerate.
+    chunk.vertices.assign(static_cast<std::size_t>(ChunkTiles * ChunkTiles) * VerticesPerTile, sf::Vertex());
+    for (int localY = 0; localY < ChunkTiles && minY + localY < rows; ++localY) {
+        for (int localX = 0; localX < ChunkTiles && minX + localX < columns; ++localX) {
+            int x = minX + localX;
+            int y = minY + localY;
+            std::size_t slot = static_cast<std::size_t>(localY) * ChunkTiles + localX;
+
+            sf::Vector2f topLeft = {static_cast<float>(x) * tileSize, static_cast<float>(y) * tileSize};
+            sf::Vector2f topRight = topLeft + sf::Vector2f(tileSize, 0.0f);
+            sf::Vector2f bottomLeft = topLeft + sf::Vector2f(0.0f, tileSize);
+            sf::Vector2f bottomRight = topLeft + sf::Vector2f(tileSize, tileSize);
+
+            sf::Vertex* quad = &chunk.vertices[slot * VerticesPerTile];
+            quad[0].position = topLeft;
+            quad[1].position = topRight;
+            quad[2].position = bottomLeft;
+            quad[3].position = bottomLeft;
+            quad[4].position = topRight;
+            quad[5].position = bottomRight;
+
+            quad[0].texCoords = texMin;
+            quad[1].texCoords = {texMax.x, texMin.y};
+            quad[2].texCoords = {texMin.x, texMax.y};
+            quad[3].texCoords = {texMin.x, texMax.y};
+            quad[4].texCoords = {texMax.x, texMin.y};
+            quad[5].texCoords = texMax;
+
+            std::uint32_t claimedColor = chunkClaims && !chunkClaims->baseColors.empty() ? chunkClaims->baseColors[slot] : 0;
+            sf::Color color = claimedColor != 0 ? sf::Color(claimedColor) : Tile::getTileTypeColor(grid->getType(grid->index(x, y)));
+            setTileColor(chunk, slot, color);
+        }
+    }
+    chunk.dirty = true;
+}
+
+Arena_Renderer::Chunk_Cache& Arena_Renderer::acquireChunk(int chunkX, int chunkY) {
+    Chunk_Cache& chunk = cache[static_cast<std::size_t>(chunkY) * chunkColumns + chunkX];
+    if (chunk.vertices.empty()) {
+        buildChunkVertices(chunkX, chunkY, chunk);
+    }
+    chunk.lastDrawn = frameCount;
+    return chunk;
+}
+
+void Arena_Renderer::applyTileChange(const Tile_Change& change) {
+    if (!grid) {
+        return;
+    }
+    std::size_t slot;
+    std::size_t chunkIndex = chunkOf(change.tileIndex, slot);
+
+    Chunk_Claims& chunkClaims = claims[chunkIndex];
+    if (chunkClaims.baseColors.empty()) {
+        chunkClaims.baseColors.assign(static_cast<std::size_t>(ChunkTiles * ChunkTiles), 0);
+    }
+    chunkClaims.baseColors[slot] = change.baseColor.toInteger();
+
+    if (grid->getType(change.tileIndex) != TileSpecialType::NONE) {
+        auto special = std::find_if(chunkClaims.specials.begin(), chunkClaims.specials.end(),
+                                    [&](const Claimed_Special& tile) { return tile.tileIndex == change.tileIndex; });
+        if (special != chunkClaims.specials.end()) {
+            *special = {change.tileIndex, change.ownerID, change.ownerViewColor};
+        } else {
+            chunkClaims.specials.push_back({change.tileIndex, change.ownerID, change.ownerViewColor});
+        }
+    }
+
+    auto cached = cache.find(chunkIndex);
+    if (cached != cache.end() && !cached->second.vertices.empty()) {
+        setTileColor(cached->second, slot, change.baseColor);
+        cached->second.dirty = true;
+    }
+}
+
+bool Arena_Renderer::renderChunk(int chunkX, int chunkY, Chunk_Cache& chunk) {
+    float tileSize = Tile::getSize();
+    float chunkWorldSize = static_cast<float>(ChunkTiles) * tileSize;
+    sf::Vector2f chunkOrigin = {static_cast<float>(chunkX) * chunkWorldSize, static_cast<float>(chunkY) * chunkWorldSize};
+
+    if (!chunk.texture) {
+        unsigned int texturePixels = static_cast<unsigned int>(std::ceil(chunkWorldSize));
+        chunk.texture = std::make_unique<sf::RenderTexture>();
+        if (!chunk.texture->resize({texturePixels, texturePixels})) {
+            chunk.texture.reset();
+            return false;
+        }
+    }
+
+    sf::RenderStates states;
+    states.texture = texture;
+    chunk.texture->setView(sf::View(sf::FloatRect(chunkOrigin, {chunkWorldSize, chunkWorldSize})));
+    chunk.texture->clear(sf::Color::Transparent);
+    chunk.texture->draw(chunk.vertices.data(), chunk.vertices.size(), sf::PrimitiveType::Triangles, states);
+    chunk.texture->display();
+    chunk.dirty = false;
+    return true;
+}
+
+void Arena_Renderer::appendOverlay(std::size_t chunkIndex, int perspectivePlayerID) {
+    auto found = claims.find(chunkIndex);
+    if (found == claims.end()) {
+        return;
+    }
+    const Chunk_Cache& chunk = cache.at(chunkIndex);
+    for (const Claimed_Special& tile : found->second.specials) {
+        std::size_t slot;
+        chunkOf(tile.tileIndex, slot);
+        const sf::Vertex* quad = &chunk.vertices[slot * VerticesPerTile];
+        if (tile.ownerID != perspectivePlayerID || tile.ownerViewColor == quad[0].color) {
+            continue;
+        }
+        for (std::size_t k = 0; k < VerticesPerTile; ++k) {
+            overlayVertices.push_back({quad[k].position, tile.ownerViewColor, quad[k].texCoords});
+        }
+    }
+}
+
+void Arena_Renderer::evictChunks() {
+    if (cache.size() <= MaxCachedChunks) {
+        return;
+    }
+    std::vector<std::pair<std::uint64_t, std::size_t>> candidates;
+    for (const auto& [chunkIndex, chunk] : cache) {
+        if (chunk.lastDrawn < frameCount) {
+            candidates.push_back({chunk.lastDrawn, chunkIndex});
+        }
+    }
+    std::size_t excess = std::min(cache.size() - MaxCachedChunks, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + excess, candidates.end());
+    for (std::size_t i = 0; i < excess; ++i) {
+        cache.erase(candidates[i].second);
+    }
+}
+
+void Arena_Renderer::draw(sf::RenderTarget& target, int perspectivePlayerID, Cull_Stats* stats) {
+    if (!grid || columns == 0 || rows == 0) {
+        return;
+    }
+    float tileSize = Tile::getSize();
+    float chunkWorldSize = static_cast<float>(ChunkTiles) * tileSize;
+    sf::FloatRect viewBounds = Culling::getViewWorldBounds(target.getView());
+
+    int minX = std::max(0, static_cast<int>(std::floor(viewBounds.position.x / tileSize)));
+    int maxX = std::min(columns - 1, static_cast<int>(std::floor((viewBounds.position.x + viewBounds.size.x) / tileSize)));
+    int minY = std::max(0, static_cast<int>(std::floor(viewBounds.position.y / tileSize)));
+    int maxY = std::min(rows - 1, static_cast<int>(std::floor((viewBounds.position.y + viewBounds.size.y) / tileSize)));
+
+    unsigned long long totalTiles = static_cast<unsigned long long>(columns) * rows;
+    unsigned long long visibleTiles = 0;
+
+    if (minX <= maxX && minY <= maxY) {
+        sf::RenderStates states;
+        states.texture = texture;
+        scratchVertices.clear();
+        overlayVertices.clear();
+
+        for (int chunkY = minY / ChunkTiles; chunkY <= maxY / ChunkTiles; ++chunkY) {
+            for (int chunkX = minX / ChunkTiles; chunkX <= maxX / ChunkTiles; ++chunkX) {
+                Chunk_Cache& chunk = acquireChunk(chunkX, chunkY);
+                if (chunkCacheEnabled && chunk.dirty && !renderChunk(chunkX, chunkY, chunk)) {
+                    chunkCacheEnabled = false;
+                }
+                if (chunkCacheEnabled) {
+                    sf::Sprite chunkSprite(chunk.texture->getTexture());
+                    chunkSprite.setPosition({static_cast<float>(chunkX) * chunkWorldSize, static_cast<float>(chunkY) * chunkWorldSize});
+                    target.draw(chunkSprite);
+                } else {
+                    scratchVertices.insert(scratchVertices.end(), chunk.vertices.begin(), chunk.vertices.end());
+                }
+                appendOverlay(static_cast<std::size_t>(chunkY) * chunkColumns + chunkX, perspectivePlayerID);
+            }
+        }
+
+        if (!scratchVertices.empty()) {
+            target.draw(scratchVertices.data(), scratchVertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+        if (!overlayVertices.empty()) {
+            target.draw(overlayVertices.data(), overlayVertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+
+        // Whole chunks are drawn, so count the range widened to chunk borders.
+        int drawnMinX = minX - minX % ChunkTiles;
+        int drawnMinY = minY - minY % ChunkTiles;
+        int drawnMaxX = std::min(columns - 1, maxX - maxX % ChunkTiles + ChunkTiles - 1);
+        int drawnMaxY = std::min(rows - 1, maxY - maxY % ChunkTiles + ChunkTiles - 1);
+        visibleTiles = static_cast<unsigned long long>(drawnMaxX - drawnMinX + 1) * (drawnMaxY - drawnMinY + 1);
+    }
+
+    if (stats) {
+        stats->tilesSubmitted += visibleTiles;
+        stats->tilesCulled += totalTiles - visibleTiles;
+    }
+}
@@ -0,0 +1,82 @@
+#ifndef ARENA_RENDERER_H
+#define ARENA_RENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include "Tiles/Tiles.h"
+#include "Tile_Grid.h"
+#include "../Culling.h"
+
+// Draws the tile grid in ChunkTiles x ChunkTiles chunks, so the cost of a
+// frame follows the visible area rather than the map size.
+// A chunk's textured geometry is built the first time it comes into view and
+// rendered once into an sf::RenderTexture, then only re-rendered after a tile
+// inside it changes; a view blits a handful of chunk quads. At most
+// MaxCachedChunks are kept, dropping the least recently drawn; a chunk any
+// view drew in the current frame is never dropped.
+// Claims are mirrored per chunk (allocated on first claim) so evicted chunks
+// can be rebuilt; claimed special tiles, which look different to their owner,
+// are drawn on top for that player's view. Falls back to drawing the chunk
+// geometry directly when render textures are unavailable.
+// Only tile types, which never change, are read from the grid, so the
+// renderer can run on a different thread than the one claiming tiles.
+class Arena_Renderer {
+    static constexpr std::size_t VerticesPerTile = 6;
+    static constexpr int ChunkTiles = 16;
+    static constexpr std::size_t MaxCachedChunks = 128;
+
+    struct Claimed_Special {
+        std::size_t tileIndex;
+        int ownerID;
+        sf::Color ownerViewColor;
+    };
+
+    struct Chunk_Claims {
+        std::vector<std::uint32_t> baseColors; // packed, 0 while unclaimed
+        std::vector<Claimed_Special> specials;
+    };
+
+    struct Chunk_Cache {
+        std::vector<sf::Vertex> vertices;
+        std::unique_ptr<sf::RenderTexture> texture;
+        bool dirty = true;
+        std::uint64_t lastDrawn = 0;
+    };
+
+    const Tile_Grid* grid = nullptr;
+    std::unordered_map<std::size_t, Chunk_Claims> claims;
+    std::unordered_map<std::size_t, Chunk_Cache> cache;
+    std::vector<sf::Vertex> scratchVertices;
+    std::vector<sf::Vertex> overlayVertices;
+    const sf::Texture* texture;
+    sf::IntRect textureRegion;
+    int columns = 0;
+    int rows = 0;
+    int chunkColumns = 0;
+    std::uint64_t frameCount = 0;
+    bool chunkCacheEnabled = true;
+
+    std::size_t chunkOf(std::size_t tileIndex, std::size_t& slot) const;
+    Chunk_Cache& acquireChunk(int chunkX, int chunkY);
+    void buildChunkVertices(int chunkX, int chunkY, Chunk_Cache& chunk);
+    void setTileColor(Chunk_Cache& chunk, std::size_t slot, sf::Color color);
+    bool renderChunk(int chunkX, int chunkY, Chunk_Cache& chunk);
+    void appendOverlay(std::size_t chunkIndex, int perspectivePlayerID);
+    void evictChunks();
+
+public:
+    explicit Arena_Renderer(const sf::Texture* tileTexture = nullptr, const sf::IntRect& tileRegion = {});
+
+    void build(const Tile_Grid& tileGrid);
+    void applyTileChange(const Tile_Change& change);
+    // Call once per frame, before the first view is drawn.
+    void beginFrame() { ++frameCount; }
+    // Call once per frame, after the last view is drawn.
+    void endFrame() { evictChunks(); }
+    void draw(sf::RenderTarget& target, int perspectivePlayerID, Cull_Stats* stats = nullptr);
+};
+
+#endif // ARENA_RENDERER_H
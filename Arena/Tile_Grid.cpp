@@ -0,0 +1,190 @@
+#include "Tile_Grid.h"
+
+#include <algorithm>
+
+namespace {
+    // splitmix64 finalizer: cheap and well mixed enough for tile rolls.
+    std::uint64_t mix(std::uint64_t value) {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+}
+
+Tile_Grid::Owner_Page::Owner_Page() {
+    owners.fill(-1);
+    ownerColors.fill(0);
+}
+
+Tile_Grid::Tile_Grid(int width, int height, std::uint64_t seed, const Tile_Odds& odds) :
+    width(width),
+    height(height),
+    seed(seed),
+    odds(odds),
+    pageColumns((width + PageTiles - 1) / PageTiles) {
+    int pageRows = (height + PageTiles - 1) / PageTiles;
+    pages.resize(static_cast<std::size_t>(pageColumns) * pageRows);
+}
+
+std::size_t Tile_Grid::pageOf(std::size_t tileIndex, std::size_t& slot) const {
+    int x = static_cast<int>(tileIndex % width);
+    int y = static_cast<int>(tileIndex / width);
+    slot = static_cast<std::size_t>(y % PageTiles) * PageTiles + x % PageTiles;
+    return static_cast<std::size_t>(y / PageTiles) * pageColumns + x / PageTiles;
+}
+
+TileSpecialType Tile_Grid::getType(std::size_t tileIndex) const {
+    float roll = static_cast<float>(mix(seed ^ mix(tileIndex)) >> 40) / static_cast<float>(1u << 24);
+
+    if (roll < odds.teleporter) {
+        return TileSpecialType::TELEPORTER;
+    }
+    roll -= odds.teleporter;
+    if (roll < odds.damage) {
+        return TileSpecialType::DAMAGE;
+    }
+    roll -= odds.damage;
+    if (roll < odds.sticky) {
+        return TileSpecialType::STICKY;
+    }
+    roll -= odds.sticky;
+    if (roll < odds.healing) {
+        return TileSpecialType::HEALING;
+    }
+    roll -= odds.healing;
+    if (roll < odds.super) {
+        return TileSpecialType::SUPER;
+    }
+    return TileSpecialType::NONE;
+}
+
+int Tile_Grid::getOwner(std::size_t tileIndex) const {
+    std::size_t slot;
+    const Owner_Page* page = pages[pageOf(tileIndex, slot)].get();
+    return page ? page->owners[slot] : -1;
+}
+
+bool Tile_Grid::claim(std::size_t tileIndex, int playerID, sf::Color color) {
+    std::size_t slot;
+    std::unique_ptr<Owner_Page>& page = pages[pageOf(tileIndex, slot)];
+    if (!page) {
+        page = std::make_unique<Owner_Page>();
+        ++allocatedPages;
+    }
+
+    std::uint32_t packedColor = color.toInteger();
+    int previousOwner = page->owners[slot];
+    if (previousOwner == playerID && page->ownerColors[slot] == packedColor) {
+        return false;
+    }
+    if (previousOwner != playerID) {
+        if (previousOwner != -1) {
+            --ownedCounts[previousOwner];
+        }
+        if (playerID != -1) {
+            if (static_cast<std::size_t>(playerID) >= ownedCounts.size()) {
+                ownedCounts.resize(static_cast<std::size_t>(playerID) + 1, 0);
+            }
+            ++ownedCounts[playerID];
+        }
+    }
+    page->owners[slot] = static_cast<std::int8_t>(playerID);
+    page->ownerColors[slot] = packedColor;
+    return true;
+}
+
+std::size_t Tile_Grid::claimSpans(const std::vector<Tile_Span>& spans, int playerID, sf::Color color, std::vector<Tile_Change>& changes) {
+    std::uint32_t packedColor = color.toInteger();
+    // Owners are int8, so every previous owner fits.
+    std::array<int, 128> lost{};
+    int gained = 0;
+    std::size_t changed = 0;
+
+    for (const Tile_Span& span : spans) {
+        std::size_t pageRow = static_cast<std::size_t>(span.y / PageTiles) * pageColumns;
+        std::size_t slotRow = static_cast<std::size_t>(span.y % PageTiles) * PageTiles;
+        std::size_t rowStart = index(0, span.y);
+
+        for (int pageX = span.x0; pageX <= span.x1;) {
+            std::unique_ptr<Owner_Page>& page = pages[pageRow + pageX / PageTiles];
+            if (!page) {
+                page = std::make_unique<Owner_Page>();
+                ++allocatedPages;
+            }
+            std::int8_t* owners = page->owners.data() + slotRow;
+            std::uint32_t* ownerColors = page->ownerColors.data() + slotRow;
+            int pageEnd = std::min(span.x1, (pageX / PageTiles + 1) * PageTiles - 1);
+            int firstSlot = pageX % PageTiles;
+            int lastSlot = pageEnd % PageTiles;
+
+            // Only tiles that actually change are counted and reported; the
+            // segment is then written in one go.
+            for (int slot = firstSlot; slot <= lastSlot; ++slot) {
+                int previousOwner = owners[slot];
+                if (previousOwner == playerID && ownerColors[slot] == packedColor) {
+                    continue;
+                }
+                if (previousOwner != playerID) {
+                    if (previousOwner != -1) {
+                        ++lost[previousOwner];
+                    }
+                    ++gained;
+                }
+                ++changed;
+
+                std::size_t tileIndex = rowStart + static_cast<std::size_t>(pageX - firstSlot + slot);
+                TileSpecialType type = getType(tileIndex);
+                sf::Color baseColor = playerID != -1 ? color : Tile::getTileTypeColor(type);
+                sf::Color ownerViewColor = playerID != -1 && type != TileSpecialType::NONE ? Tile::getTileTypeColor(type) : baseColor;
+                changes.push_back({tileIndex, playerID, baseColor, ownerViewColor});
+            }
+            std::fill(owners + firstSlot, owners + lastSlot + 1, static_cast<std::int8_t>(playerID));
+            std::fill(ownerColors + firstSlot, ownerColors + lastSlot + 1, packedColor);
+            pageX = pageEnd + 1;
+        }
+    }
+
+    for (std::size_t owner = 0; owner < ownedCounts.size(); ++owner) {
+        ownedCounts[owner] -= lost[owner];
+    }
+    if (playerID != -1 && gained > 0) {
+        if (static_cast<std::size_t>(playerID) >= ownedCounts.size()) {
+            ownedCounts.resize(static_cast<std::size_t>(playerID) + 1, 0);
+        }
+        ownedCounts[playerID] += gained;
+    }
+    return changed;
+}
+
+int Tile_Grid::getOwnedCount(int playerID) const {
+    if (playerID < 0 || static_cast<std::size_t>(playerID) >= ownedCounts.size()) {
+        return 0;
+    }
+    return ownedCounts[playerID];
+}
+
+sf::Color Tile_Grid::getBaseColor(std::size_t tileIndex) const {
+    std::size_t slot;
+    const Owner_Page* page = pages[pageOf(tileIndex, slot)].get();
+    if (!page || page->owners[slot] == -1) {
+        return Tile::getTileTypeColor(getType(tileIndex));
+    }
+    return sf::Color(page->ownerColors[slot]);
+}
+
+sf::Color Tile_Grid::getDrawColor(std::size_t tileIndex, int viewingPlayerID) const {
+    int owner = getOwner(tileIndex);
+    if (owner != -1 && owner == viewingPlayerID && getType(tileIndex) != TileSpecialType::NONE) {
+        return Tile::getTileTypeColor(getType(tileIndex));
+    }
+    return getBaseColor(tileIndex);
+}
+
+sf::Vector2f Tile_Grid::getTilePosition(int x, int y) const {
+    return {static_cast<float>(x) * Tile::getSize(), static_cast<float>(y) * Tile::getSize()};
+}
+
+sf::FloatRect Tile_Grid::getTileBounds(int x, int y) const {
+    return {getTilePosition(x, y), {Tile::getSize(), Tile::getSize()}};
+}
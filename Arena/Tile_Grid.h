@@ -0,0 +1,100 @@
+#ifndef TILE_GRID_H
+#define TILE_GRID_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Tiles/Tiles.h"
+
+// Chance of a tile rolling each special type; the rest are plain tiles.
+struct Tile_Odds {
+    float teleporter;
+    float damage;
+    float sticky;
+    float healing;
+    float super;
+};
+
+// Ownership change of one tile, carrying everything the renderer needs so it
+// never has to read the live ownership state of the grid.
+struct Tile_Change {
+    std::size_t tileIndex;
+    int ownerID;
+    sf::Color baseColor;
+    sf::Color ownerViewColor;
+};
+
+// Tiles x0..x1 of row y, both ends included.
+struct Tile_Span {
+    int y;
+    int x0;
+    int x1;
+};
+
+// Tile state indexed by y * width + x, sized for maps far larger than what is
+// ever on screen:
+// - the special type is not stored but derived from a hash of the seed and
+//   the tile index, so it costs nothing until asked for;
+// - owner and claim color live in PageTiles x PageTiles pages of parallel
+//   arrays that are only allocated when a tile in them is first claimed.
+// Tiles owned per player are counted as claims happen, so territory queries
+// never scan the grid.
+class Tile_Grid {
+public:
+    static constexpr int PageTiles = 64;
+
+private:
+    struct Owner_Page {
+        std::array<std::int8_t, PageTiles * PageTiles> owners;
+        std::array<std::uint32_t, PageTiles * PageTiles> ownerColors;
+
+        Owner_Page();
+    };
+
+    int width;
+    int height;
+    std::uint64_t seed;
+    Tile_Odds odds;
+    int pageColumns;
+    std::vector<std::unique_ptr<Owner_Page>> pages;
+    std::size_t allocatedPages = 0;
+    std::vector<int> ownedCounts;
+
+    std::size_t pageOf(std::size_t tileIndex, std::size_t& slot) const;
+
+public:
+    Tile_Grid(int width, int height, std::uint64_t seed, const Tile_Odds& odds);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    std::size_t size() const { return static_cast<std::size_t>(width) * height; }
+    std::size_t index(int x, int y) const { return static_cast<std::size_t>(y) * width + x; }
+    bool contains(int x, int y) const { return x >= 0 && x < width && y >= 0 && y < height; }
+    std::size_t getAllocatedPages() const { return allocatedPages; }
+
+    // Only reads the seed and odds, so any thread may call it.
+    TileSpecialType getType(std::size_t tileIndex) const;
+    int getOwner(std::size_t tileIndex) const;
+    int getOwnedCount(int playerID) const;
+
+    // Returns false when the tile already had this owner and color.
+    bool claim(std::size_t tileIndex, int playerID, sf::Color color);
+    // Claims every tile of spans, such as all rows of one paint stroke,
+    // writing each page's part of a row in one go and updating the owned
+    // counts once for the whole call. Only tiles that changed have their
+    // type looked up and get a Tile_Change appended; returns how many did.
+    // Spans must lie inside the grid and may overlap.
+    std::size_t claimSpans(const std::vector<Tile_Span>& spans, int playerID, sf::Color color, std::vector<Tile_Change>& changes);
+
+    // Color seen by every player except the owner, and by the owner, who
+    // still sees the special type of a tile they claimed.
+    sf::Color getBaseColor(std::size_t tileIndex) const;
+    sf::Color getDrawColor(std::size_t tileIndex, int viewingPlayerID) const;
+
+    sf::Vector2f getTilePosition(int x, int y) const;
+    sf::FloatRect getTileBounds(int x, int y) const;
+};
+
+#endif // TILE_GRID_H
@@ -0,0 +1,44 @@
+#ifndef TILE_EFFECTS_H
+#define TILE_EFFECTS_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <stdexcept>
+#include "Tiles.h"
+
+// What standing on a tile does to a player. A new tile type is one more
+// TileSpecialType value and one more row in Tile_Effects::Table.
+struct Tile_Effect {
+    sf::Color color;
+    float slowFactor = 1.0f;    // speed multiplier while on the tile, 1 = no slow down
+    int entryDamage = 0;        // applied once when stepping onto the tile
+    int tickDamage = 0;         // applied every damage tick while staying on it
+    int entryHeal = 0;
+    bool healOwnerOnly = false; // heal only the player that claimed the tile
+    bool teleports = false;     // move the player to a random tile on entry
+
+    constexpr bool slows() const { return slowFactor < 1.0f; }
+    constexpr bool damages() const { return entryDamage > 0 || tickDamage > 0; }
+};
+
+namespace Tile_Effects {
+    inline constexpr std::array<Tile_Effect, TileSpecialTypeCount> Table = {{
+        // color                   slow   entry tick heal  owner  teleport
+        {sf::Color::White,         1.0f,  0,    0,   0,    false, false}, // NONE
+        {sf::Color::Yellow,        0.4f,  0,    0,   0,    false, false}, // STICKY
+        {sf::Color::Red,           1.0f,  1,    1,   0,    false, false}, // DAMAGE
+        {sf::Color::Green,         1.0f,  0,    0,   2,    true,  false}, // HEALING
+        {sf::Color::Magenta,       1.0f,  0,    0,   0,    false, true},  // TELEPORTER
+        {sf::Color(128, 0, 128),   0.2f,  5,    1,   0,    false, false}, // SUPER
+    }};
+
+    constexpr const Tile_Effect& get(TileSpecialType type) {
+        std::size_t row = static_cast<std::size_t>(type);
+        if (row >= Table.size()) {
+            throw std::invalid_argument("Invalid special type");
+        }
+        return Table[row];
+    }
+}
+
+#endif // TILE_EFFECTS_H
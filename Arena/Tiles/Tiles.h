@@ -2,9 +2,7 @@
 #define TILES_H
 
 #include <SFML/Graphics.hpp>
-#include <SFML/Window.hpp>
-#include <vector>
-#include <iostream>
+#include <cstddef>
 
 enum class TileSpecialType {
     NONE = 0,
@@ -15,37 +13,18 @@ enum class TileSpecialType {
     SUPER
 };
 
+constexpr std::size_t TileSpecialTypeCount = 6;
+
+// Tile state lives in Tile_Grid and tile behaviour in Tile_Effects; this only
+// holds what every tile shares.
 class Tile {
 private:
     static float TileSize;
-    sf::RectangleShape tileShape;
-    sf::Vector2f coordinates;
-    std::vector<sf::Sprite> tileSprites;
-    bool has_texture;
-    int ownerPlayerID = -1;
-    sf::Color ownerColor;
-protected:
-    TileSpecialType initialSpecialType;
 public:
-    virtual ~Tile();
-    sf::Color getTileTypeColor(TileSpecialType type) const;
-
-    Tile(const float x, const float y, TileSpecialType type = TileSpecialType::NONE);
-
-    Tile(sf::Texture const& texture, const float x, const float y, TileSpecialType type = TileSpecialType::NONE);
-
-    Tile(const Tile& other);
-
-    virtual void draw(sf::RenderWindow& window, int viewingPlayerID);
-    void claimTile(int playerID, sf::Color pColor);
-
-    sf::Vector2f getPosition() const { return coordinates; }
+    static sf::Color getTileTypeColor(TileSpecialType type);
     static float getSize() { return TileSize; }
-    sf::FloatRect getBounds() const{return tileShape.getGlobalBounds();};
-    int getOwner() const { return ownerPlayerID; }
-    TileSpecialType getSpecialType() const { return initialSpecialType; }
 };
 
 
 
-#endif // TILES_H
\ No newline at end of file
+#endif // TILES_H
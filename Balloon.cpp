@@ -1,73 +1,88 @@
 #include "Balloon.h"
 #include "Player.h"
-#include <cmath>
 
-int AttackBalloon::damage=10;
-float AttackBalloon::lifespan = 12.0f;
-float AttackBalloon::radius = 8.0f;
-
-AttackBalloon::AttackBalloon(const sf::Color& color, sf::Vector2f startCoordinates, int ownerID)
-    : sf::CircleShape(radius),
-      ownerID(ownerID)
-{
-    this->setFillColor(color);
-    this->setOrigin({radius, radius});
-    this->setPosition(startCoordinates);
-}
-
-void AttackBalloon::setTarget(const Player* targe) {
-    target = targe;
-}
-
-const Player* AttackBalloon::getTarget() const {
-    return target;
-}
-
-int AttackBalloon::getOwnerID() const {
-    return ownerID;
-}
-
-void AttackBalloon::launch(sf::Vector2f initialVel) {
-    m_initialLaunchVelocity = initialVel;
-    m_currentVelocity = initialVel;
-    lifetimeClock.restart();
+int Balloon_Pool::damage = 10;
+std::int32_t Balloon_Pool::lifespanTicks = static_cast<std::int32_t>(Sim_Time::ticks(12.0f));
+float Balloon_Pool::radius = 8.0f;
+float Balloon_Pool::trackingSpeed = 250.f;
+float Balloon_Pool::maxSpeed = 700.f;
+float Balloon_Pool::initialLaunchDuration = 0.5f;
+
+Balloon_Pool::Balloon_Pool(std::size_t capacity) : poolCapacity(capacity), kernelPath(Balloon_Kernel::bestPath()) {
+    positionX.reserve(capacity);
+    positionY.reserve(capacity);
+    velocityX.reserve(capacity);
+    velocityY.reserve(capacity);
+    launchX.reserve(capacity);
+    launchY.reserve(capacity);
+    ageTicks.reserve(capacity);
+    ownerID.reserve(capacity);
+    targetIndex.reserve(capacity);
+    color.reserve(capacity);
+    expiryTimer.reserve(capacity);
 }
 
-void AttackBalloon::update(float deltaTime) {
-    sf::Vector2f trackingForce = {0.0f, 0.0f};
-
-    if (target != nullptr && !target->isEliminatedPlayer()) {
-        sf::Vector2f targetPosition = target->getPosition();
-        sf::Vector2f balloonPosition = this->getPosition();
-
-        sf::Vector2f directionToTarget = targetPosition - balloonPosition;
-        float distanceToTarget = std::sqrt(directionToTarget.x * directionToTarget.x + directionToTarget.y * directionToTarget.y);
-
-        if (distanceToTarget !=0) {
-            trackingForce = (directionToTarget / distanceToTarget) * m_trackingSpeed;
-        }
+bool Balloon_Pool::spawn(const sf::Color& ownerColor, sf::Vector2f position, int owner, int target, sf::Vector2f launchVelocity, Timer_Handle expiry) {
+    if (full()) {
+        return false;
     }
+    positionX.push_back(position.x);
+    positionY.push_back(position.y);
+    velocityX.push_back(launchVelocity.x);
+    velocityY.push_back(launchVelocity.y);
+    launchX.push_back(launchVelocity.x);
+    launchY.push_back(launchVelocity.y);
+    ageTicks.push_back(0);
+    ownerID.push_back(owner);
+    targetIndex.push_back(target);
+    color.push_back(ownerColor);
+    expiryTimer.push_back(expiry);
+    return true;
+}
 
-    float elapsed = lifetimeClock.getElapsedTime().asSeconds();
-    float attenuationFactor = 0.0f;
-    if (elapsed < initialLaunchDuration) {
-        float t = elapsed / initialLaunchDuration;
-        attenuationFactor = std::pow(1.0f - t, 1.5f);
+bool Balloon_Pool::remove(std::size_t i) {
+    std::size_t last = size() - 1;
+    bool moved = i != last;
+    if (moved) {
+        positionX[i] = positionX[last];
+        positionY[i] = positionY[last];
+        velocityX[i] = velocityX[last];
+        velocityY[i] = velocityY[last];
+        launchX[i] = launchX[last];
+        launchY[i] = launchY[last];
+        ageTicks[i] = ageTicks[last];
+        ownerID[i] = ownerID[last];
+        targetIndex[i] = targetIndex[last];
+        color[i] = color[last];
+        expiryTimer[i] = expiryTimer[last];
     }
+    positionX.pop_back();
+    positionY.pop_back();
+    velocityX.pop_back();
+    velocityY.pop_back();
+    launchX.pop_back();
+    launchY.pop_back();
+    ageTicks.pop_back();
+    ownerID.pop_back();
+    targetIndex.pop_back();
+    color.pop_back();
+    expiryTimer.pop_back();
+    return moved;
+}
 
-    m_currentVelocity = (m_initialLaunchVelocity * attenuationFactor) + trackingForce;
-
-    float currentSpeedMagnitude = std::sqrt(m_currentVelocity.x * m_currentVelocity.x + m_currentVelocity.y * m_currentVelocity.y);
-    if (currentSpeedMagnitude > m_maxSpeed) {
-        m_currentVelocity = (m_currentVelocity / currentSpeedMagnitude) * m_maxSpeed;
-    } else if ((attenuationFactor == 0.0f &&  currentSpeedMagnitude < 1.0f) || target == nullptr) {
-        m_currentVelocity = {0.0f, 0.0f};
+void Balloon_Pool::update(const std::vector<Player>& players) {
+    targetX.assign(1, 0.0f);
+    targetY.assign(1, 0.0f);
+    targetTracking.assign(1, 0.0f);
+    for (const Player& player : players) {
+        targetX.push_back(player.getPosition().x);
+        targetY.push_back(player.getPosition().y);
+        targetTracking.push_back(player.isEliminatedPlayer() ? 0.0f : 1.0f);
     }
 
-    this->move(m_currentVelocity * deltaTime);
-}
-
-bool AttackBalloon::isExpired() const {
-    return lifetimeClock.getElapsedTime().asSeconds() >= lifespan;
+    Balloon_Lanes lanes = {positionX.data(), positionY.data(), velocityX.data(), velocityY.data(),
+                           launchX.data(), launchY.data(), ageTicks.data(), targetIndex.data(), size()};
+    Balloon_Targets targets = {targetX.data(), targetY.data(), targetTracking.data(), static_cast<int>(players.size())};
+    Balloon_Motion motion = {trackingSpeed, maxSpeed, initialLaunchDuration};
+    Balloon_Kernel::update(lanes, targets, motion, Sim_Time::StepSeconds, kernelPath);
 }
-
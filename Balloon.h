@@ -2,34 +2,73 @@
 #define BALLOON_H
 
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Simulation/Balloon_Kernel.h"
+#include "Simulation/Timer_Wheel.h"
 
 class Player;
 
-class AttackBalloon : public sf::CircleShape {
-    const Player* target = nullptr;
-    int ownerID;
+// Every balloon of a match, stored as parallel arrays. The arrays are
+// reserved to the full capacity up front, so spawning never allocates; a
+// dead balloon is replaced by the last one, so indices are not stable
+// across remove(). update() advances every balloon by one simulation step,
+// running Balloon_Kernel on the widest path the CPU has. Ages are counted
+// in ticks; expiry is a timer the owner schedules and hands to spawn().
+// Drawing is done in batches by Balloon_Renderer.
+class Balloon_Pool {
     static int damage;
-    float m_trackingSpeed = 250.f;
-    float m_maxSpeed = 700.f;
-    sf::Vector2f m_initialLaunchVelocity = {0.0f, 0.0f};
-    sf::Vector2f m_currentVelocity = {0.0f, 0.0f};
-    float initialLaunchDuration = 0.5f;
-    static float lifespan;
+    static std::int32_t lifespanTicks;
     static float radius;
-    sf::Clock lifetimeClock;
+    static float trackingSpeed;
+    static float maxSpeed;
+    static float initialLaunchDuration;
+
+    std::size_t poolCapacity;
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> launchX;
+    std::vector<float> launchY;
+    std::vector<std::int32_t> ageTicks;
+    std::vector<int> ownerID;
+    // Index into the simulation's players, -1 for none.
+    std::vector<int> targetIndex;
+    std::vector<sf::Color> color;
+    std::vector<Timer_Handle> expiryTimer;
+
+    Balloon_Kernel::Path kernelPath;
+    std::vector<float> targetX;
+    std::vector<float> targetY;
+    std::vector<float> targetTracking;
+
 public:
+    static constexpr std::size_t DefaultCapacity = 1 << 17;
+
+    explicit Balloon_Pool(std::size_t capacity = DefaultCapacity);
 
+    static int getDamage() { return damage; }
+    static float getRadius() { return radius; }
+    static Sim_Time::Tick getLifespanTicks() { return static_cast<Sim_Time::Tick>(lifespanTicks); }
 
-    AttackBalloon(const sf::Color& color, sf::Vector2f startCoordinates, int ownerID);
+    std::size_t size() const { return ageTicks.size(); }
+    std::size_t capacity() const { return poolCapacity; }
+    bool empty() const { return ageTicks.empty(); }
+    bool full() const { return size() >= poolCapacity; }
 
-    void setTarget(const Player* target);
-    const Player* getTarget() const;
-    int getOwnerID() const;
-    static int getDamage(){return damage;};
-    void launch(sf::Vector2f initialVel);
-    void update(float deltaTime);
-    bool isExpired() const;
+    // Returns false, and spawns nothing, when the pool is full.
+    bool spawn(const sf::Color& ownerColor, sf::Vector2f position, int owner, int target, sf::Vector2f launchVelocity, Timer_Handle expiry);
+    // Returns true if the last balloon was moved into slot i.
+    bool remove(std::size_t i);
+    void update(const std::vector<Player>& players);
 
+    sf::Vector2f getPosition(std::size_t i) const { return {positionX[i], positionY[i]}; }
+    sf::Color getColor(std::size_t i) const { return color[i]; }
+    int getOwnerID(std::size_t i) const { return ownerID[i]; }
+    int getTarget(std::size_t i) const { return targetIndex[i]; }
+    Timer_Handle getExpiryTimer(std::size_t i) const { return expiryTimer[i]; }
 };
 
-#endif
\ No newline at end of file
+#endif
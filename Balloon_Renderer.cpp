@@ -0,0 +1,72 @@
+#include "Balloon_Renderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+sf::Image Balloon_Renderer::createBalloonImage() {
+    sf::Image image({ImageSize, ImageSize}, sf::Color::Transparent);
+    float center = static_cast<float>(ImageSize) / 2.0f;
+    for (unsigned int y = 0; y < ImageSize; ++y) {
+        for (unsigned int x = 0; x < ImageSize; ++x) {
+            float dx = static_cast<float>(x) + 0.5f - center;
+            float dy = static_cast<float>(y) + 0.5f - center;
+            float coverage = std::clamp(center - std::sqrt(dx * dx + dy * dy), 0.0f, 1.0f);
+            if (coverage > 0.0f) {
+                image.setPixel({x, y}, sf::Color(255, 255, 255, static_cast<std::uint8_t>(coverage * 255.0f)));
+            }
+        }
+    }
+    return image;
+}
+
+void Balloon_Renderer::setTexture(const sf::Texture& balloonTexture, const sf::IntRect& region) {
+    texture = &balloonTexture;
+    textureRegion = region;
+}
+
+void Balloon_Renderer::draw(sf::RenderTarget& target, const std::vector<Balloon_Pose>& balloons, Cull_Stats* stats) {
+    if (!texture) {
+        ownTexture = std::make_unique<sf::Texture>();
+        if (!ownTexture->loadFromImage(createBalloonImage())) {
+            std::cerr << "Failed to create the balloon texture" << std::endl;
+            ownTexture.reset();
+            return;
+        }
+        setTexture(*ownTexture, sf::IntRect({0, 0}, {static_cast<int>(ImageSize), static_cast<int>(ImageSize)}));
+    }
+
+    sf::FloatRect viewBounds = Culling::getViewWorldBounds(target.getView());
+    sf::Vector2f texMin = sf::Vector2f(textureRegion.position);
+    sf::Vector2f texMax = texMin + sf::Vector2f(textureRegion.size);
+    float radius = Balloon_Pool::getRadius();
+
+    vertices.clear();
+    vertices.reserve(balloons.size() * VerticesPerBalloon);
+    for (const auto& balloon : balloons) {
+        sf::FloatRect bounds({balloon.position.x - radius, balloon.position.y - radius}, {2.0f * radius, 2.0f * radius});
+        bool visible = Culling::overlaps(bounds, viewBounds);
+        if (stats) {
+            stats->countEntity(visible);
+        }
+        if (!visible) {
+            continue;
+        }
+        sf::Vector2f topLeft = bounds.position;
+        sf::Vector2f bottomRight = bounds.position + bounds.size;
+        sf::Color color = balloon.color;
+        vertices.push_back({topLeft, color, texMin});
+        vertices.push_back({{bottomRight.x, topLeft.y}, color, {texMax.x, texMin.y}});
+        vertices.push_back({{topLeft.x, bottomRight.y}, color, {texMin.x, texMax.y}});
+        vertices.push_back({{topLeft.x, bottomRight.y}, color, {texMin.x, texMax.y}});
+        vertices.push_back({{bottomRight.x, topLeft.y}, color, {texMax.x, texMin.y}});
+        vertices.push_back({bottomRight, color, texMax});
+    }
+    if (vertices.empty()) {
+        return;
+    }
+
+    sf::RenderStates states;
+    states.texture = texture;
+    target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, states);
+}
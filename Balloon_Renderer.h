@@ -0,0 +1,30 @@
+#ifndef BALLOON_RENDERER_H
+#define BALLOON_RENDERER_H
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+#include "Balloon.h"
+#include "Culling.h"
+#include "Frame_Snapshot.h"
+
+// Writes every visible balloon into one vertex batch of textured quads
+// tinted with the owner's color, so all balloons cost one draw call per view.
+class Balloon_Renderer {
+    static constexpr std::size_t VerticesPerBalloon = 6;
+    static constexpr unsigned int ImageSize = 64;
+
+    const sf::Texture* texture = nullptr;
+    sf::IntRect textureRegion;
+    std::unique_ptr<sf::Texture> ownTexture;
+    std::vector<sf::Vertex> vertices;
+
+public:
+    // White disc with a soft edge, meant to be packed into the texture atlas.
+    static sf::Image createBalloonImage();
+
+    void setTexture(const sf::Texture& balloonTexture, const sf::IntRect& region);
+    void draw(sf::RenderTarget& target, const std::vector<Balloon_Pose>& balloons, Cull_Stats* stats = nullptr);
+};
+
+#endif // BALLOON_RENDERER_H
@@ -1,6 +1,20 @@
+#include <iostream>
+#include <stdexcept>
 #include "Game.h"
-int main() {
+#include "Game_Settings.h"
+int main(int argc, char* argv[]) {
+    Game_Settings settings;
+    try {
+        settings = Game_Settings::fromArguments(argc, argv);
+    } catch (std::invalid_argument& e) {
+        std::cerr << e.what() << '\n' << Game_Settings::usage();
+        return 1;
+    }
+    if (settings.help) {
+        std::cout << Game_Settings::usage();
+        return 0;
+    }
     Game_Engine &game_engine=Game_Engine::Instance();
-    game_engine.GameLoop();
+    game_engine.GameLoop(settings);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,39 @@
+#ifndef CULLING_H
+#define CULLING_H
+
+#include <SFML/Graphics.hpp>
+
+// Per-frame counters of what was sent to the GPU and what was skipped
+// because it was outside the view.
+struct Cull_Stats {
+    unsigned long long tilesSubmitted = 0;
+    unsigned long long tilesCulled = 0;
+    unsigned int entitiesSubmitted = 0;
+    unsigned int entitiesCulled = 0;
+
+    void reset() { *this = Cull_Stats(); }
+    void countEntity(bool visible) {
+        if (visible) {
+            ++entitiesSubmitted;
+        } else {
+            ++entitiesCulled;
+        }
+    }
+};
+
+namespace Culling {
+    // World-space rectangle covered by an unrotated view.
+    inline sf::FloatRect getViewWorldBounds(const sf::View& view) {
+        sf::Vector2f size = view.getSize();
+        return sf::FloatRect(view.getCenter() - size / 2.0f, size);
+    }
+
+    inline bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b) {
+        return a.position.x < b.position.x + b.size.x &&
+               a.position.x + a.size.x > b.position.x &&
+               a.position.y < b.position.y + b.size.y &&
+               a.position.y + a.size.y > b.position.y;
+    }
+}
+
+#endif // CULLING_H
@@ -0,0 +1,93 @@
+#include "Frame_Pacer.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // sf::sleep can overshoot by a scheduler quantum, so the last stretch
+    // before a deadline is spent spinning instead.
+    const sf::Time SPIN_THRESHOLD = sf::milliseconds(2);
+    const sf::Time REPORT_INTERVAL = sf::seconds(5.0f);
+
+    float averageMilliseconds(const std::vector<sf::Time>& samples) {
+        if (samples.empty()) {
+            return 0.0f;
+        }
+        sf::Time total;
+        for (sf::Time sample : samples) {
+            total += sample;
+        }
+        return static_cast<float>(total.asMicroseconds()) / 1000.0f / static_cast<float>(samples.size());
+    }
+
+    float maxMilliseconds(const std::vector<sf::Time>& samples) {
+        if (samples.empty()) {
+            return 0.0f;
+        }
+        return static_cast<float>(std::max_element(samples.begin(), samples.end())->asMicroseconds()) / 1000.0f;
+    }
+}
+
+Frame_Pacer::Frame_Pacer(const Game_Settings& settings) :
+    pacing(settings.pacing),
+    framePeriod(sf::microseconds(1000000 / std::max(1u, settings.targetFps))),
+    reportStats(settings.frameStats) {
+}
+
+void Frame_Pacer::apply(sf::RenderWindow& window) const {
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(pacing == Frame_Pacing::VSync);
+}
+
+void Frame_Pacer::beginFrame() {
+    frameStart = clock.getElapsedTime();
+}
+
+void Frame_Pacer::beginPresent() {
+    presentStart = clock.getElapsedTime();
+}
+
+void Frame_Pacer::endFrame() {
+    sf::Time presentEnd = clock.getElapsedTime();
+    lastCpuTime = presentStart - frameStart;
+    lastPresentTime = presentEnd - presentStart;
+    if (reportStats) {
+        cpuTimes.push_back(lastCpuTime);
+        presentTimes.push_back(lastPresentTime);
+    }
+
+    if (pacing == Frame_Pacing::FixedRate) {
+        waitForDeadline();
+    }
+    if (reportStats && clock.getElapsedTime() - lastReport >= REPORT_INTERVAL) {
+        report();
+    }
+}
+
+void Frame_Pacer::waitForDeadline() {
+    sf::Time now = clock.getElapsedTime();
+    nextDeadline += framePeriod;
+    // Fell more than a frame behind: start a new schedule instead of rushing to catch up.
+    if (nextDeadline < now - framePeriod) {
+        nextDeadline = now;
+        return;
+    }
+    if (nextDeadline - now > SPIN_THRESHOLD) {
+        sf::sleep(nextDeadline - now - SPIN_THRESHOLD);
+    }
+    while (clock.getElapsedTime() < nextDeadline) {
+    }
+}
+
+void Frame_Pacer::report() {
+    sf::Time now = clock.getElapsedTime();
+    float seconds = (now - lastReport).asSeconds();
+    float fps = seconds > 0.0f ? static_cast<float>(cpuTimes.size()) / seconds : 0.0f;
+    std::cout << "Frames: " << fps << " fps"
+              << " | CPU avg " << averageMilliseconds(cpuTimes) << " ms, max " << maxMilliseconds(cpuTimes) << " ms"
+              << " | Present avg " << averageMilliseconds(presentTimes) << " ms, max " << maxMilliseconds(presentTimes) << " ms"
+              << std::endl;
+    cpuTimes.clear();
+    presentTimes.clear();
+    lastReport = now;
+}
@@ -0,0 +1,45 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <vector>
+#include "Game_Settings.h"
+
+// Applies the selected frame pacing to a window and measures every frame:
+// CPU time (beginFrame to beginPresent) and present time (the display()
+// call). In FixedRate mode endFrame sleeps until shortly before the next
+// deadline and spins for the rest, which is far more precise than
+// sf::Window::setFramerateLimit.
+class Frame_Pacer {
+    Frame_Pacing pacing;
+    sf::Time framePeriod;
+    bool reportStats;
+
+    sf::Clock clock;
+    sf::Time frameStart;
+    sf::Time presentStart;
+    sf::Time nextDeadline;
+    sf::Time lastReport;
+    sf::Time lastCpuTime;
+    sf::Time lastPresentTime;
+
+    std::vector<sf::Time> cpuTimes;
+    std::vector<sf::Time> presentTimes;
+
+    void waitForDeadline();
+    void report();
+
+public:
+    explicit Frame_Pacer(const Game_Settings& settings);
+
+    void apply(sf::RenderWindow& window) const;
+    void beginFrame();
+    void beginPresent();
+    void endFrame();
+
+    sf::Time getLastCpuTime() const { return lastCpuTime; }
+    sf::Time getLastPresentTime() const { return lastPresentTime; }
+};
+
+#endif // FRAME_PACER_H
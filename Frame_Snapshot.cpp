@@ -0,0 +1,42 @@
+#include "Frame_Snapshot.h"
+
+#include <chrono>
+
+void Frame_Snapshot::clear() {
+    balloons.clear();
+    tileChanges.clear();
+    printCullStats = false;
+}
+
+void Frame_Snapshot::carryOver(const Frame_Snapshot& unread) {
+    tileChanges.insert(tileChanges.begin(), unread.tileChanges.begin(), unread.tileChanges.end());
+    printCullStats = printCullStats || unread.printCullStats;
+}
+
+Frame_Snapshot& Snapshot_Buffer::beginWrite() {
+    Frame_Snapshot& snapshot = slots[writeIndex];
+    snapshot.clear();
+    return snapshot;
+}
+
+void Snapshot_Buffer::publish() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (hasReady) {
+            slots[writeIndex].carryOver(slots[readyIndex]);
+        }
+        std::swap(writeIndex, readyIndex);
+        hasReady = true;
+    }
+    readyCondition.notify_one();
+}
+
+const Frame_Snapshot* Snapshot_Buffer::acquire(sf::Time timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!readyCondition.wait_for(lock, std::chrono::microseconds(timeout.asMicroseconds()), [this] { return hasReady; })) {
+        return nullptr;
+    }
+    std::swap(readIndex, readyIndex);
+    hasReady = false;
+    return &slots[readIndex];
+}
@@ -0,0 +1,66 @@
+#ifndef FRAME_SNAPSHOT_H
+#define FRAME_SNAPSHOT_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Player.h"
+#include "Arena/Tile_Grid.h"
+
+// Everything the renderer needs to draw one player, copied out of Player.
+struct Player_Pose {
+    int playerID = -1;
+    sf::Vector2f position;
+    AnimationDirection direction = AnimDown;
+    bool moving = false;
+    bool facingLeft = false;
+    bool eliminated = false;
+    unsigned int health = 0;
+    int ownedTiles = 0;
+};
+
+struct Balloon_Pose {
+    sf::Vector2f position;
+    sf::Color color;
+};
+
+// Immutable picture of one simulation step, handed from the simulation to
+// the renderer. The renderer never touches the Simulation directly.
+struct Frame_Snapshot {
+    std::vector<Player_Pose> players;
+    std::vector<Balloon_Pose> balloons;
+    std::vector<Tile_Change> tileChanges;
+    std::vector<sf::Vector2f> viewCenters;
+    std::vector<float> zoomFactors;
+    Sim_Time::Tick tick = 0;
+    int totalTiles = 0;
+    bool printCullStats = false;
+
+    void clear();
+    // Keeps the one-shot parts of a snapshot the renderer never saw.
+    void carryOver(const Frame_Snapshot& unread);
+};
+
+// Triple buffer between the simulation and render threads: the writer
+// always has a free slot, the reader always gets the newest published
+// snapshot, and neither waits for the other to finish a frame.
+class Snapshot_Buffer {
+    std::array<Frame_Snapshot, 3> slots;
+    std::size_t writeIndex = 0;
+    std::size_t readyIndex = 1;
+    std::size_t readIndex = 2;
+    bool hasReady = false;
+    std::mutex mutex;
+    std::condition_variable readyCondition;
+
+public:
+    Frame_Snapshot& beginWrite();
+    void publish();
+    // Waits up to timeout for a new snapshot; returns nullptr if none arrived.
+    const Frame_Snapshot* acquire(sf::Time timeout);
+};
+
+#endif // FRAME_SNAPSHOT_H
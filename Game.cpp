@@ -1,19 +1,42 @@
 #include "Game.h"
 #include "Arena/Tiles/Tiles.h"
 #include "Player.h"
-#include "Balloon.h"
 #include "Resource_Manager.h"
-#include "Arena/Tiles/Super_Tile.h"
+#include <cmath>
 
 namespace  {
-    constexpr float INITIAL_LAUNCH_FORCE = 1500.0f;
-    constexpr float SPAWN_OFFSET_DISTANCE = 30.0f;
-    constexpr float SPAWN_COOLDOWN = 1.0f;
     constexpr float DIVIDING_LINE_WIDTH = 4.0f;
-    constexpr int PAINT_RADIUS = 3;
     constexpr float ZOOM_SPEED = 0.9f;
     constexpr float MIN_ZOOM_FACTOR = 0.5;
     constexpr float MAX_ZOOM_FACTOR = 1;
+    const std::string TILE_TEXTURE_PATH = "../Assets/sprite_tile2.jpg";
+    const std::string PLAYER1_TEXTURE_PATH = "../Assets/hero.png";
+    const std::string PLAYER2_TEXTURE_PATH = "../Assets/base_character.png";
+    const std::string BALLOON_IMAGE_NAME = "balloon";
+    // Fixed simulation step, the longest frame the accumulator will try to
+    // catch up on, and how long the render thread waits for a snapshot
+    // before checking whether it should stop.
+    const sf::Time SIMULATION_STEP = sf::seconds(Simulation::StepSeconds);
+    const sf::Time MAX_FRAME_TIME = sf::milliseconds(250);
+    const sf::Time RENDER_WAIT_TIMEOUT = sf::milliseconds(100);
+    constexpr std::uint8_t ZOOM_BITS = actionBit(Player_Action::ZoomIn) | actionBit(Player_Action::ZoomOut);
+
+    // Splits the window into a near-square grid of viewports, one per
+    // player. A short last row is stretched to fill the width.
+    std::vector<sf::FloatRect> tileViewports(int count) {
+        int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count))));
+        int rows = (count + columns - 1) / columns;
+        std::vector<sf::FloatRect> viewports;
+        viewports.reserve(count);
+        for (int row = 0; row < rows; ++row) {
+            int inRow = std::min(columns, count - row * columns);
+            for (int column = 0; column < inRow; ++column) {
+                viewports.emplace_back(sf::Vector2f(static_cast<float>(column) / inRow, static_cast<float>(row) / rows),
+                                       sf::Vector2f(1.0f / inRow, 1.0f / rows));
+            }
+        }
+        return viewports;
+    }
 }
 
 Game_Engine& Game_Engine::Instance() {
@@ -22,163 +45,167 @@ Game_Engine& Game_Engine::Instance() {
 }
 
 Game_Engine::Game_Engine() :
-    rng(std::chrono::high_resolution_clock::now().time_since_epoch().count()),
-    coordDist(0, 0),
     gameFont(Resource_Manager<sf::Font>::Instance().getResource("../Assets/Font.ttf")),
     uiHandler(gameFont){
 }
 
-void Game_Engine::processPlayerTileInteraction(Player& player, float dt, std::vector<std::vector<std::unique_ptr<Tile>>>& grid) {
-    sf::FloatRect playerBounds = player.getBounds();
-    int gridSize = Arena::GetGridSize();
-    float tileSize = Tile::getSize();
-
-    int minTileX = static_cast<int>(playerBounds.position.x / tileSize);
-    int maxTileX = static_cast<int>((playerBounds.position.x + playerBounds.size.x) / tileSize);
-    int minTileY = static_cast<int>(playerBounds.position.y / tileSize);
-    int maxTileY = static_cast<int>((playerBounds.position.y + playerBounds.size.y) / tileSize);
-
-    minTileX = std::max(0, minTileX);
-    maxTileX = std::min(gridSize - 1, maxTileX);
-    minTileY = std::max(0, minTileY);
-    maxTileY = std::min(gridSize - 1, maxTileY);
-
-    player.setStuck(false,1);
-    player.setOnDamageTile(false);
-
-    Tile* currentIntersectedTile = nullptr;
-
-    for (int y = minTileY; y <= maxTileY; ++y) {
-        for (int x = minTileX; x <= maxTileX; ++x) {
-            if (y >= 0 && static_cast<size_t>(y) < grid.size() && x >= 0 && static_cast<size_t>(x) < grid[y].size()) {
-                Tile& tile = *grid[y][x];
-                sf::FloatRect tileBounds = tile.getBounds();
-                bool manual_intersects =
-                    playerBounds.position.x < tileBounds.position.x + tileBounds.size.x &&
-                    playerBounds.position.x + playerBounds.size.x > tileBounds.position.x &&
-                    playerBounds.position.y < tileBounds.position.y + tileBounds.size.y &&
-                    playerBounds.position.y + playerBounds.size.y > tileBounds.position.y;
-
-                if (manual_intersects) {
-                    sf::Vector2i currentTileIdx = {x, y};
-                    bool enteredThisTile = (player.getLastGridPosition() != currentTileIdx);
-
-                    switch (tile.getSpecialType()) {
-                        case TileSpecialType::STICKY: {
-                            std::unique_ptr<StickyTile> stickyTile=std::make_unique<StickyTile>(dynamic_cast<StickyTile&>(tile));
-                            float slow_factor=stickyTile->getslowfactor();
-                            player.setStuck(true,slow_factor);
-                            currentIntersectedTile = &tile;
-                            break;
-                        }
-                        case TileSpecialType::DAMAGE:
-                            player.setOnDamageTile(true);
-                            currentIntersectedTile = &tile;
-                            if (enteredThisTile) {
-                                player.takeInitialDamage();
-                                player.restartDamageTickClock();
-                            } else {
-                                if (player.getDamageElapsedTime().asSeconds() >= player.getDamageTickRate()) {
-                                    player.takeContinuousDamage();
-                                    player.restartDamageTickClock();
-                                }
-                            }
-                            break;
-                        case TileSpecialType::TELEPORTER:
-                            currentIntersectedTile = &tile;
-                            if (enteredThisTile) {
-                                    int newX = coordDist(rng);
-                                    int newY = coordDist(rng);
-                                    sf::Vector2f newPos = {static_cast<float>(newX * tileSize + tileSize / 2.0f),
-                                                           static_cast<float>(newY * tileSize + tileSize / 2.0f)};
-                                    player.setPosition(newPos);
-                                    player.setLastGridPosition({-1,-1});
-                            }
-                            break;
-                        case TileSpecialType::HEALING:
-                             currentIntersectedTile = &tile;
-                            if (tile.getOwner() == player.getPlayerID() && enteredThisTile) {
-                                player.heal(2);
-                            }
-                            break;
-                        case TileSpecialType::SUPER: {
-                            std::unique_ptr<SuperTile> supertile=std::make_unique<SuperTile>(dynamic_cast<SuperTile&>(tile));
-                            float slowfactor,damage_factor;
-                            supertile->getData(slowfactor,damage_factor);
-                            player.setStuck(true,slowfactor);
-                            player.setOnDamageTile(true);
-                            currentIntersectedTile = &tile;
-                            if (enteredThisTile) {
-                                player.getDamageTile(damage_factor);
-                                player.restartDamageTickClock();
-                            } else {
-                                if (player.getDamageElapsedTime().asSeconds() >= player.getDamageTickRate()) {
-                                    player.takeContinuousDamage();
-                                    player.restartDamageTickClock();
-                                }
-                            }
-                            break;
-                        }
-                        case TileSpecialType::NONE:
-                        default:
-                            break;
-                    }
-                     if (currentIntersectedTile) player.setLastGridPosition(currentTileIdx);
-                }
-            }
+void Game_Engine::updateUIDelegator(unsigned int windowWidth, unsigned int windowHeight, const Frame_Snapshot& snapshot) {
+    uiHandler.onWindowResized(windowWidth, windowHeight);
+    for (std::size_t i = 0; i < snapshot.players.size(); ++i) {
+        uiHandler.onHealthChanged(static_cast<int>(i), snapshot.players[i].health);
+        uiHandler.onOwnershipChanged(static_cast<int>(i), snapshot.players[i].ownedTiles, snapshot.totalTiles);
+    }
+}
+
+void Game_Engine::drawUIDelegator(sf::RenderWindow& window) {
+    uiHandler.draw(window);
+}
+
+void Game_Engine::drawWorldView(sf::RenderWindow& window, const sf::View& view, Arena& arena, int perspectivePlayerID, const Frame_Snapshot& snapshot) {
+    window.setView(view);
+    arena.draw(window, perspectivePlayerID, &frameCullStats);
+
+    sf::FloatRect viewBounds = Culling::getViewWorldBounds(view);
+    for (std::size_t i = 0; i < snapshot.players.size(); ++i) {
+        const Player_Pose& pose = snapshot.players[i];
+        if (pose.eliminated) {
+            continue;
         }
-        if (currentIntersectedTile) {
-            break;
+        bool visible = Culling::overlaps(Player_Sprite::getBounds(pose), viewBounds);
+        frameCullStats.countEntity(visible);
+        if (visible) {
+            playerSprites[i].draw(window, pose);
         }
     }
-     if (!currentIntersectedTile && player.getIsOnDamageTile()) {
-        player.setOnDamageTile(false);
-    }
+    balloonRenderer.draw(window, snapshot.balloons, &frameCullStats);
 }
 
+void Game_Engine::printCullStats() const {
+    std::cout << "Tiles submitted: " << frameCullStats.tilesSubmitted
+              << ", culled: " << frameCullStats.tilesCulled
+              << " | Entities submitted: " << frameCullStats.entitiesSubmitted
+              << ", culled: " << frameCullStats.entitiesCulled << std::endl;
+}
 
-void Game_Engine::updateUIDelegator(unsigned int windowWidth, unsigned int windowHeight, Player& player1, Player& player2, const Arena& arena) {
-    uiHandler.update(windowWidth, windowHeight, player1, player2, arena);
+void Game_Engine::layoutViews(sf::Vector2u windowSize, const std::vector<sf::FloatRect>& viewports) {
+    sf::Vector2f window(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y));
+    views.assign(viewports.size(), sf::View());
+    baseViewSizes.clear();
+    dividingLines.clear();
+    for (std::size_t i = 0; i < viewports.size(); ++i) {
+        const sf::FloatRect& viewport = viewports[i];
+        views[i].setViewport(viewport);
+        baseViewSizes.push_back({window.x * viewport.size.x, window.y * viewport.size.y});
+
+        // Each viewport draws the line along its right and bottom edges,
+        // unless that edge is the window's.
+        sf::Vector2f topLeft = {window.x * viewport.position.x, window.y * viewport.position.y};
+        sf::Vector2f bottomRight = topLeft + baseViewSizes.back();
+        if (viewport.position.x + viewport.size.x < 0.999f) {
+            sf::RectangleShape& line = dividingLines.emplace_back(sf::Vector2f(DIVIDING_LINE_WIDTH, baseViewSizes.back().y));
+            line.setPosition({bottomRight.x - DIVIDING_LINE_WIDTH / 2.0f, topLeft.y});
+        }
+        if (viewport.position.y + viewport.size.y < 0.999f) {
+            sf::RectangleShape& line = dividingLines.emplace_back(sf::Vector2f(baseViewSizes.back().x, DIVIDING_LINE_WIDTH));
+            line.setPosition({topLeft.x, bottomRight.y - DIVIDING_LINE_WIDTH / 2.0f});
+        }
+    }
+    for (sf::RectangleShape& line : dividingLines) {
+        line.setFillColor(sf::Color::Black);
+    }
 }
 
-void Game_Engine::drawUIDelegator(sf::RenderWindow& window) {
-    uiHandler.draw(window);
+void Game_Engine::buildSnapshot(Frame_Snapshot& snapshot, Simulation& simulation, const std::vector<float>& zoomFactors) {
+    simulation.takeTileChanges(snapshot.tileChanges);
+
+    const std::vector<Player>& players = simulation.getPlayers();
+    snapshot.players.resize(players.size());
+    snapshot.viewCenters.resize(players.size());
+    for (std::size_t i = 0; i < snapshot.players.size(); ++i) {
+        const Player& player = players[i];
+        Player_Pose& pose = snapshot.players[i];
+        pose.playerID = player.getPlayerID();
+        pose.position = player.getPosition();
+        pose.direction = player.getCurrentAnimationDirection();
+        pose.moving = player.getIsMoving();
+        pose.facingLeft = player.isFacingLeft();
+        pose.eliminated = player.isEliminatedPlayer();
+        pose.health = player.getHealth();
+        pose.ownedTiles = simulation.getOwnedTileCount(pose.playerID);
+    }
+    snapshot.totalTiles = simulation.getTotalTiles();
+    snapshot.tick = simulation.getTickCount();
+
+    const Balloon_Pool& balloons = simulation.getBalloons();
+    snapshot.balloons.reserve(balloons.size());
+    for (std::size_t i = 0; i < balloons.size(); ++i) {
+        snapshot.balloons.push_back({balloons.getPosition(i), balloons.getColor(i)});
+    }
+
+    // An eliminated player's view watches the middle of the arena.
+    sf::Vector2f worldCenter = simulation.getWorldSize() / 2.0f;
+    for (std::size_t i = 0; i < players.size(); ++i) {
+        snapshot.viewCenters[i] = players[i].isEliminatedPlayer() ? worldCenter : players[i].getPosition();
+    }
+
+    snapshot.zoomFactors = zoomFactors;
 }
 
-int Game_Engine::checkWinCondition(Player& player1, Player& player2, const Arena& arena) {
-    std::map<int, int> tileCounts = arena.getPlayerTileCounts();
-    int player1Owned = tileCounts.count(player1.getPlayerID()) ? tileCounts.at(player1.getPlayerID()) : 0;
-    int player2Owned = tileCounts.count(player2.getPlayerID()) ? tileCounts.at(player2.getPlayerID()) : 0;
-    int totalPlayableTiles = arena.GetGridSize()* arena.GetGridSize();
+void Game_Engine::renderFrame(sf::RenderWindow& window, Arena& arena, const Frame_Snapshot& snapshot) {
+    arena.applyTileChanges(snapshot.tileChanges);
+    arena.beginFrame();
+    for (std::size_t i = 0; i < playerSprites.size(); ++i) {
+        playerSprites[i].animate(snapshot.players[i], snapshot.tick);
+    }
 
-    std::string winnerTitle;
+    for (std::size_t i = 0; i < views.size(); ++i) {
+        views[i].setSize(baseViewSizes[i] * snapshot.zoomFactors[i]);
+        views[i].setCenter(snapshot.viewCenters[i]);
+    }
 
-    if (totalPlayableTiles > 0) {
-        int winTileThreshold = (totalPlayableTiles / 2) + 1;
-        if (player1Owned >= winTileThreshold) {
-            return 1;
-        }
-        if (player2Owned >= winTileThreshold) {
-            return 2;
-        }
+    window.clear(sf::Color::White);
+    frameCullStats.reset();
+    for (std::size_t i = 0; i < views.size(); ++i) {
+        drawWorldView(window, views[i], arena, snapshot.players[i].playerID, snapshot);
     }
+    arena.endFrame();
 
-    if (player1.getHealth() == 0 && player2.getHealth() > 0) {
-        return 2;
+    window.setView(window.getDefaultView());
+    for (const sf::RectangleShape& line : dividingLines) {
+        window.draw(line);
     }
-    if (player2.getHealth() == 0 && player1.getHealth() > 0) {
-        return 1;
+    updateUIDelegator(window.getSize().x, window.getSize().y, snapshot);
+    drawUIDelegator(window);
+
+    if (snapshot.printCullStats) {
+        printCullStats();
     }
-    if (player1.getHealth() == 0 && player2.getHealth() == 0) {
-        return 0;
+}
+
+void Game_Engine::renderLoop(sf::RenderWindow& window, Arena& arena, Snapshot_Buffer& snapshots, Frame_Pacer& pacer, const std::atomic<bool>& rendering) {
+    if (!window.setActive(true)) {
+        std::cerr << "Failed to activate the window on the render thread" << std::endl;
+        return;
+    }
+    while (rendering) {
+        const Frame_Snapshot* snapshot = snapshots.acquire(RENDER_WAIT_TIMEOUT);
+        if (!snapshot) {
+            continue;
+        }
+        pacer.beginFrame();
+        renderFrame(window, arena, *snapshot);
+        pacer.beginPresent();
+        window.display();
+        pacer.endFrame();
+    }
+    if (!window.setActive(false)) {
+        std::cerr << "Failed to release the window on the render thread" << std::endl;
     }
-    return -1;
 }
 
-void Game_Engine::GameLoop() {
-    int gridSize = Arena::GetGridSize();
-    float tileSize = Tile::getSize();
-    coordDist = std::uniform_int_distribution<int>(0, gridSize - 1);
+void Game_Engine::GameLoop(const Game_Settings& settings) {
+    Simulation simulation(settings.gridSize, Simulation::RandomSeed(), settings.players);
+    int playerCount = simulation.getPlayerCount();
 
     sf::VideoMode desktopMode = sf::VideoMode::getDesktopMode();
     if (!desktopMode.isValid()) {
@@ -188,22 +215,45 @@ void Game_Engine::GameLoop() {
     unsigned int windowWidth = window.getSize().x;
     unsigned int windowHeight = window.getSize().y;
 
-    window.setVerticalSyncEnabled(true);
+    Frame_Pacer pacer(settings);
+    pacer.apply(window);
 
     sf::Texture* defaultTileTexture_try = nullptr;
     sf::Texture* playerTexture1_try = nullptr;
     sf::Texture* playerTexture2_try = nullptr;
+    sf::IntRect tileRegion;
+    sf::Vector2i player1SheetOrigin = {0, 0};
+    sf::Vector2i player2SheetOrigin = {0, 0};
     Arena* arena_try = nullptr;
     try {
-        sf::Texture& tempDefaultTileTexture = Resource_Manager<sf::Texture>::Instance().getResource("../Assets/sprite_tile2.jpg");
-        sf::Texture& tempPlayerTexture1 = Resource_Manager<sf::Texture>::Instance().getResource("../Assets/hero.png");
-        sf::Texture& tempPlayerTexture2 = Resource_Manager<sf::Texture>::Instance().getResource("../Assets/base_character.png");
-
-        defaultTileTexture_try = &tempDefaultTileTexture;
-        playerTexture1_try = &tempPlayerTexture1;
-        playerTexture2_try = &tempPlayerTexture2;
+        Resource_Manager<sf::Texture>& textures = Resource_Manager<sf::Texture>::Instance();
+        try {
+            if (!textures.hasAtlas()) {
+                textures.registerAtlasImage(TILE_TEXTURE_PATH);
+                textures.registerAtlasImage(PLAYER1_TEXTURE_PATH);
+                textures.registerAtlasImage(PLAYER2_TEXTURE_PATH);
+                textures.registerAtlasImage(BALLOON_IMAGE_NAME, Balloon_Renderer::createBalloonImage());
+                textures.buildAtlas();
+            }
+            sf::Texture& atlas = textures.getAtlasTexture();
+            defaultTileTexture_try = &atlas;
+            playerTexture1_try = &atlas;
+            playerTexture2_try = &atlas;
+            tileRegion = textures.getAtlasRegion(TILE_TEXTURE_PATH);
+            player1SheetOrigin = textures.getAtlasRegion(PLAYER1_TEXTURE_PATH).position;
+            player2SheetOrigin = textures.getAtlasRegion(PLAYER2_TEXTURE_PATH).position;
+            balloonRenderer.setTexture(atlas, textures.getAtlasRegion(BALLOON_IMAGE_NAME));
+        } catch (std::runtime_error& e) {
+            std::cerr << e.what() << ", using separate textures" << std::endl;
+            defaultTileTexture_try = &textures.getResource(TILE_TEXTURE_PATH);
+            playerTexture1_try = &textures.getResource(PLAYER1_TEXTURE_PATH);
+            playerTexture2_try = &textures.getResource(PLAYER2_TEXTURE_PATH);
+            tileRegion = sf::IntRect();
+            player1SheetOrigin = {0, 0};
+            player2SheetOrigin = {0, 0};
+        }
 
-        Arena& tempArena = Arena::getInstance(*defaultTileTexture_try);
+        Arena& tempArena = Arena::getInstance(*defaultTileTexture_try, tileRegion);
         arena_try = &tempArena;
     }catch (std::runtime_error& e) {
         std::cerr << e.what() << std::endl;
@@ -213,175 +263,116 @@ void Game_Engine::GameLoop() {
         std::cerr<<"Unknown error!"<<std::endl;
     }
 
-    sf::Texture& playerTexture1 = *playerTexture1_try;
-    sf::Texture& playerTexture2 = *playerTexture2_try;
     Arena& arena = *arena_try;
-    std::vector<std::vector<std::unique_ptr<Tile>>>& grid = arena.GetGrid();
-    float p1StartX = tileSize * 2.0f;
-    float p1StartY = tileSize * 2.0f;
-    float p2StartX = static_cast<float>(gridSize * tileSize) - (tileSize * 2.0f);
-    float p2StartY = static_cast<float>(gridSize * tileSize) - (tileSize * 2.0f);
-
-    Player* player1 = Player::acquirePlayer(1, sf::Color::Blue, {p1StartX, p1StartY}, true, &playerTexture1);
-    Player* player2 = Player::acquirePlayer(2, sf::Color::Cyan, {p2StartX, p2StartY}, false, &playerTexture2);
-    activeBalloons.clear();
-    gameEnded = false;
+    // Players past the second reuse the two sheets, tinted in their colour.
+    std::vector<sf::Color> playerColors;
+    playerSprites.assign(playerCount, Player_Sprite());
+    for (int i = 0; i < playerCount; ++i) {
+        sf::Color color = simulation.getPlayers()[i].getColor();
+        playerColors.push_back(color);
+        sf::Color tint = i < 2 ? sf::Color::White : color;
+        if (i % 2 == 0) {
+            playerSprites[i].setSheet(playerTexture1_try, player1SheetOrigin, tint);
+        } else {
+            playerSprites[i].setSheet(playerTexture2_try, player2SheetOrigin, tint);
+        }
+    }
+    Simulation::Inputs inputs = 0;
     currentWinMessage.clear();
     gameClock.restart();
-    spawnClock.restart();
-    sf::View view1, view2;
-    float viewHalfWidth = static_cast<float>(windowWidth) / 2.0f;
-    float viewHeight = static_cast<float>(windowHeight);
 
-    view1.setSize({viewHalfWidth, viewHeight});
-    view1.setViewport(sf::FloatRect({0.f, 0.f}, {0.5f, 1.f}));
-    view2.setSize({viewHalfWidth, viewHeight});
-    view2.setViewport(sf::FloatRect({0.5f, 0.f}, {0.5f, 1.f}));
+    std::vector<sf::FloatRect> viewports = tileViewports(playerCount);
+    layoutViews({windowWidth, windowHeight}, viewports);
+    uiHandler.setPlayers(playerColors, viewports);
+
+    std::vector<float> zoomFactors(playerCount, 1.0f);
 
-    float player1ZoomFactor = 1.0f;
-    float player2ZoomFactor = 1.0f;
+    arena.prepareRenderer(simulation.getGrid());
 
-    sf::RectangleShape dividingLine;
-    dividingLine.setSize({DIVIDING_LINE_WIDTH, static_cast<float>(windowHeight)});
-    dividingLine.setFillColor(sf::Color::Black);
-    dividingLine.setPosition({static_cast<float>(windowWidth / 2.0f - DIVIDING_LINE_WIDTH / 2.0f), 0.0f});
+    // With a render thread the window's GL context belongs to that thread;
+    // this thread keeps polling events and running the simulation.
+    Snapshot_Buffer snapshots;
+    Frame_Snapshot localSnapshot;
+    std::atomic<bool> rendering{true};
+    std::thread renderThread;
+    if (settings.renderThread) {
+        if (window.setActive(false)) {
+            renderThread = std::thread(&Game_Engine::renderLoop, this, std::ref(window), std::ref(arena), std::ref(snapshots), std::ref(pacer), std::cref(rendering));
+        } else {
+            std::cerr << "Failed to release the window, rendering on the main thread" << std::endl;
+        }
+    }
+    bool threadedRendering = renderThread.joinable();
+
+    bool running = true;
+    sf::Time accumulator = sf::Time::Zero;
+    while (running && window.isOpen()) {
+        sf::Time frameTime = gameClock.restart();
+        accumulator += std::min(frameTime, MAX_FRAME_TIME) * settings.timeScale;
+        if (!threadedRendering) {
+            pacer.beginFrame();
+        }
 
-    while (window.isOpen()) {
-        sf::Time deltaTime = gameClock.restart();
-        float dtSeconds = deltaTime.asSeconds();
+        Frame_Snapshot& snapshot = threadedRendering ? snapshots.beginWrite() : localSnapshot;
+        if (!threadedRendering) {
+            snapshot.clear();
+        }
 
         while (const auto event = window.pollEvent()) {
             if (event->is<sf::Event::Closed>()) {
-                window.close();
+                running = false;
             }
             if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>()) {
-                if (!gameEnded) {
-                    if (player1) player1->setKeyPressed(keyPressed->code, true);
-                    if (player2) player2->setKeyPressed(keyPressed->code, true);
-
-                    if (keyPressed->code == sf::Keyboard::Key::Z) { if (player1ZoomFactor > MIN_ZOOM_FACTOR) { player1ZoomFactor *= ZOOM_SPEED; view1.zoom(ZOOM_SPEED); } }
-                    if (keyPressed->code == sf::Keyboard::Key::X) { if (player1ZoomFactor < MAX_ZOOM_FACTOR) { player1ZoomFactor /= ZOOM_SPEED; view1.zoom(1.0f / ZOOM_SPEED); } }
-                    if (keyPressed->code == sf::Keyboard::Key::O) { if (player2ZoomFactor > MIN_ZOOM_FACTOR) { player2ZoomFactor *= ZOOM_SPEED; view2.zoom(ZOOM_SPEED); } }
-                    if (keyPressed->code == sf::Keyboard::Key::P) { if (player2ZoomFactor < MAX_ZOOM_FACTOR) { player2ZoomFactor /= ZOOM_SPEED; view2.zoom(1.0f / ZOOM_SPEED); } }
-
-                    if (keyPressed->code == sf::Keyboard::Key::E) {
-                        if (spawnClock.getElapsedTime().asSeconds() >= SPAWN_COOLDOWN && player1 && !player1->isEliminatedPlayer()) {
-                            sf::Vector2f launchDirection = player1->getLaunchDirection();
-                            sf::Vector2f spawnPosition = player1->getPosition() + (launchDirection * SPAWN_OFFSET_DISTANCE);
-                            activeBalloons.emplace_back(player1->getColor(), spawnPosition,player1->getPlayerID());
-                            if (!activeBalloons.empty()) {
-                                activeBalloons.back().setTarget(player2);
-                                activeBalloons.back().launch(launchDirection * INITIAL_LAUNCH_FORCE);
-                            }
-                            spawnClock.restart();
-                        }
-                    }
-                    if (keyPressed->code == sf::Keyboard::Key::RShift) {
-                        if (spawnClock.getElapsedTime().asSeconds() >= SPAWN_COOLDOWN && player2 && !player2->isEliminatedPlayer()) {
-                            sf::Vector2f launchDirection = player2->getLaunchDirection();
-                            sf::Vector2f spawnPosition = player2->getPosition() + (launchDirection * SPAWN_OFFSET_DISTANCE);
-                            activeBalloons.emplace_back(player2->getColor(), spawnPosition, player2->getPlayerID());
-                            if (!activeBalloons.empty()) {
-                                activeBalloons.back().setTarget(player1);
-                                activeBalloons.back().launch(launchDirection * INITIAL_LAUNCH_FORCE);
-                            }
-                            spawnClock.restart();
-                        }
-                    }
-                    if (keyPressed->code == sf::Keyboard::Key::Space) { if(player1 && !player1->isEliminatedPlayer()) player1->paintNearbyTiles(grid, PAINT_RADIUS); }
-                    if (keyPressed->code == sf::Keyboard::Key::RControl) { if(player2 && !player2->isEliminatedPlayer()) player2->paintNearbyTiles(grid, PAINT_RADIUS); }
-                }
-                if (keyPressed->scancode == sf::Keyboard::Scancode::Escape) window.close();
-                if (gameEnded && keyPressed->code == sf::Keyboard::Key::Enter) {
-                    player1ZoomFactor = 1.0f;
-                    player2ZoomFactor = 1.0f;
-                    if (player1) view1.setSize({viewHalfWidth, viewHeight}); view1.setCenter(player1->getPosition());
-                    if (player2) view2.setSize({viewHalfWidth, viewHeight}); view2.setCenter(player2->getPosition());
-                }
+                keyBindings.apply(inputs, keyPressed->code, true);
+                if (keyPressed->code == sf::Keyboard::Key::F3) snapshot.printCullStats = true;
+                if (keyPressed->scancode == sf::Keyboard::Scancode::Escape) running = false;
             }
             if (const auto* keyReleased = event->getIf<sf::Event::KeyReleased>()) {
-                if (!gameEnded) {
-                    if (player1) player1->setKeyPressed(keyReleased->code, false);
-                    if (player2) player2->setKeyPressed(keyReleased->code, false);
-                }
+                keyBindings.apply(inputs, keyReleased->code, false);
             }
         }
 
-        if (!gameEnded) {
-            if(player1 && !player1->isEliminatedPlayer()) player1->updatePosition(dtSeconds);
-            if(player2 && !player2->isEliminatedPlayer()) player2->updatePosition(dtSeconds);
-            for (auto& balloon : activeBalloons) { balloon.update(dtSeconds); }
-            if(player1 && !player1->isEliminatedPlayer()) processPlayerTileInteraction(*player1, dtSeconds, grid);
-            if(player2 && !player2->isEliminatedPlayer()) processPlayerTileInteraction(*player2, dtSeconds, grid);
-            activeBalloons.erase(std::remove_if(activeBalloons.begin(), activeBalloons.end(),
-                                               [&](AttackBalloon& balloon) {
-                                                   bool hit = false;
-                                                   Player* targetPlayer = const_cast<Player*>(balloon.getTarget());
-
-                                                   if (targetPlayer && !targetPlayer->isEliminatedPlayer()){
-                                                       if (balloon.getOwnerID() != targetPlayer->getPlayerID()) {
-                                                           sf::Vector2f dist = balloon.getPosition() - targetPlayer->getPosition();
-                                                           float collisionDistanceSq = (balloon.getRadius() + targetPlayer->getRadius()) * (balloon.getRadius() + targetPlayer->getRadius());
-                                                           if ((dist.x * dist.x + dist.y * dist.y) < collisionDistanceSq) {
-                                                                targetPlayer->getDamageBalloon();
-                                                                hit = true;
-                                                           }
-                                                       }
-                                                   }
-                                                   return hit || balloon.isExpired();
-                                               }), activeBalloons.end());
-            checkWinCondition(*player1, *player2, arena);
+        // Zoom belongs to the window and is used up every frame.
+        for (int i = 0; i < playerCount; ++i) {
+            Player_Input input = Input_Words::get(inputs, i);
+            if (input.has(Player_Action::ZoomIn) && zoomFactors[i] > MIN_ZOOM_FACTOR) { zoomFactors[i] *= ZOOM_SPEED; }
+            if (input.has(Player_Action::ZoomOut) && zoomFactors[i] < MAX_ZOOM_FACTOR) { zoomFactors[i] /= ZOOM_SPEED; }
         }
+        inputs = Input_Words::clear(inputs, ZOOM_BITS);
 
-
-        if (player1 && !player1->isEliminatedPlayer()) view1.setCenter(player1->getPosition());
-        else view1.setCenter({Arena::GetGridSize() * Tile::getSize() / 4.f, Arena::GetGridSize() * Tile::getSize() / 2.f});
-
-        if (player2 && !player2->isEliminatedPlayer()) view2.setCenter(player2->getPosition());
-        else view2.setCenter({Arena::GetGridSize() * Tile::getSize() * 3.f / 4.f,
-                             Arena::GetGridSize() * Tile::getSize() / 2.f
-        });
-
-        window.clear(sf::Color::White);
-        int caz=checkWinCondition(*player1,*player2,arena);
-        if (caz==1) {
-            gameEnded = true;
-            currentWinMessage = "Player 1 Wins!";
-        }
-        if (caz==2) {
-            gameEnded = true;
-            currentWinMessage = "Player 2 Wins!";
-        }
-        if (caz==0) {
-            gameEnded = true;
-            currentWinMessage = "Draw - Both Eliminated";
+        // Launch and paint are one-shot: a press is seen by exactly one step.
+        while (accumulator >= SIMULATION_STEP && !simulation.isFinished()) {
+            simulation.step(inputs);
+            inputs = Input_Words::clear(inputs, Player_Input::OneShotBits);
+            accumulator -= SIMULATION_STEP;
         }
-        if (caz==-1) {
-            window.setView(view1);
-            arena.draw(window, player1->getPlayerID());
 
-            if(player1) player1->draw(window);
-            if(player2) player2->draw(window);
-            for (const auto& balloon : activeBalloons) { window.draw(balloon); }
-
-            window.setView(view2);
-            arena.draw(window, player2->getPlayerID());
-            if(player1) player1->draw(window);
-            if(player2) player2->draw(window);
-            for (const auto& balloon : activeBalloons) { window.draw(balloon); }
-
-
-            window.setView(window.getDefaultView());
-            window.draw(dividingLine);
-            updateUIDelegator(windowWidth, windowHeight, *player1, *player2, arena);
-            drawUIDelegator(window);
+        if (simulation.isFinished()) {
+            int result = simulation.getResult();
+            currentWinMessage = result == 0 ? "Draw - All Eliminated" : "Player " + std::to_string(result) + " Wins!";
+            std::cout<<currentWinMessage<<std::endl;
+            running = false;
+            break;
+        }
 
+        buildSnapshot(snapshot, simulation, zoomFactors);
+        if (threadedRendering) {
+            snapshots.publish();
+            sf::Time elapsed = gameClock.getElapsedTime();
+            if (elapsed < SIMULATION_STEP) {
+                sf::sleep(SIMULATION_STEP - elapsed);
+            }
         } else {
-            std::cout<<currentWinMessage<<std::endl;
-            window.close();
+            renderFrame(window, arena, snapshot);
+            pacer.beginPresent();
+            window.display();
+            pacer.endFrame();
         }
-        window.display();
     }
-    if (player1) Player::releasePlayer(player1);
-    if (player2) Player::releasePlayer(player2);
-}
\ No newline at end of file
+
+    if (threadedRendering) {
+        rendering = false;
+        renderThread.join();
+    }
+    window.close();
+}
@@ -7,11 +7,22 @@
 #include <random>
 #include <algorithm>
 #include <string>
+#include <iostream>
+#include <array>
+#include <atomic>
+#include <thread>
 
 #include "Player.h"
-#include "Balloon.h"
+#include "Player_Sprite.h"
+#include "Balloon_Renderer.h"
 #include "Arena/Arena.h"
 #include "UI_Elements.h"
+#include "Culling.h"
+#include "Frame_Snapshot.h"
+#include "Game_Settings.h"
+#include "Frame_Pacer.h"
+#include "Key_Bindings.h"
+#include "Simulation/Simulation.h"
 
 
 class Game_Engine {
@@ -27,26 +38,34 @@ public:
 
 private:
     sf::Clock gameClock;
-    sf::Clock spawnClock;
-    std::vector<AttackBalloon> activeBalloons;
-
-    std::mt19937 rng;
-    std::uniform_int_distribution<int> coordDist;
+    Key_Bindings keyBindings = Key_Bindings::Default();
+    Balloon_Renderer balloonRenderer;
 
     sf::Font gameFont;
     UI_Elements uiHandler;
 
-    bool gameEnded = false;
     std::string currentWinMessage;
 
+    // Render side: only touched by renderFrame, which may run on its own thread.
+    Cull_Stats frameCullStats;
+    // One sprite and one view per player.
+    std::vector<Player_Sprite> playerSprites;
+    std::vector<sf::View> views;
+    std::vector<sf::Vector2f> baseViewSizes;
+    std::vector<sf::RectangleShape> dividingLines;
+
 public:
-    void GameLoop();
+    void GameLoop(const Game_Settings& settings = Game_Settings());
 
 private:
-    void processPlayerTileInteraction(Player& player, float dt, std::vector<std::vector<std::unique_ptr<Tile>>>& grid);
-    void updateUIDelegator(unsigned int windowWidth, unsigned int windowHeight, Player& player1, Player& player2, const Arena& arena);
+    void updateUIDelegator(unsigned int windowWidth, unsigned int windowHeight, const Frame_Snapshot& snapshot);
     void drawUIDelegator(sf::RenderWindow& window);
-    int checkWinCondition(Player& player1, Player& player2, const Arena& arena);
+    void drawWorldView(sf::RenderWindow& window, const sf::View& view, Arena& arena, int perspectivePlayerID, const Frame_Snapshot& snapshot);
+    void printCullStats() const;
+    void layoutViews(sf::Vector2u windowSize, const std::vector<sf::FloatRect>& viewports);
+    void buildSnapshot(Frame_Snapshot& snapshot, Simulation& simulation, const std::vector<float>& zoomFactors);
+    void renderFrame(sf::RenderWindow& window, Arena& arena, const Frame_Snapshot& snapshot);
+    void renderLoop(sf::RenderWindow& window, Arena& arena, Snapshot_Buffer& snapshots, Frame_Pacer& pacer, const std::atomic<bool>& rendering);
 };
 
 #endif // GAME_H
\ No newline at end of file
@@ -0,0 +1,159 @@
+#include "Game_Settings.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+    // Players spawn two tiles in from the edges and are two tiles across, so
+    // smaller arenas put them outside the world.
+    constexpr unsigned int MIN_GRID_SIZE = 8;
+    // Keeps the tile count and world coordinates well inside int and float range.
+    constexpr unsigned int MAX_GRID_SIZE = 20000;
+    constexpr float MAX_TIME_SCALE = 100.0f;
+
+    // Returns the text after "name=" if argument starts with it, otherwise an empty string.
+    std::string optionValue(const std::string& argument, const std::string& name) {
+        std::string prefix = name + "=";
+        if (argument.compare(0, prefix.size(), prefix) == 0) {
+            return argument.substr(prefix.size());
+        }
+        return "";
+    }
+
+    unsigned int parsePositive(const std::string& value, const std::string& argument) {
+        try {
+            std::size_t end = 0;
+            int parsed = std::stoi(value, &end);
+            if (end == value.size() && parsed > 0) {
+                return static_cast<unsigned int>(parsed);
+            }
+        } catch (std::logic_error&) {
+        }
+        throw std::invalid_argument("Expected a positive number in " + argument);
+    }
+
+    float parseTimeScale(const std::string& value, const std::string& argument) {
+        try {
+            std::size_t end = 0;
+            float parsed = std::stof(value, &end);
+            if (end == value.size() && parsed > 0.0f && parsed <= MAX_TIME_SCALE) {
+                return parsed;
+            }
+        } catch (std::logic_error&) {
+        }
+        throw std::invalid_argument("Expected a time scale above 0 and at most " + std::to_string(static_cast<int>(MAX_TIME_SCALE)) + " in " + argument);
+    }
+
+    int parseGridSize(const std::string& value, const std::string& argument) {
+        unsigned int gridSize = parsePositive(value, argument);
+        if (gridSize < MIN_GRID_SIZE || gridSize > MAX_GRID_SIZE) {
+            throw std::invalid_argument("Expected a grid size between " + std::to_string(MIN_GRID_SIZE) + " and " +
+                                        std::to_string(MAX_GRID_SIZE) + " in " + argument);
+        }
+        return static_cast<int>(gridSize);
+    }
+
+    int parsePlayers(const std::string& value, const std::string& argument, int maxPlayers) {
+        unsigned int players = parsePositive(value, argument);
+        if (players < 2 || players > static_cast<unsigned int>(maxPlayers)) {
+            throw std::invalid_argument("Expected between 2 and " + std::to_string(maxPlayers) + " players in " + argument);
+        }
+        return static_cast<int>(players);
+    }
+
+    std::uint64_t parseUnsigned(const std::string& value, const std::string& argument) {
+        try {
+            std::size_t end = 0;
+            std::uint64_t parsed = std::stoull(value, &end);
+            if (end == value.size() && value.find('-') == std::string::npos) {
+                return parsed;
+            }
+        } catch (std::logic_error&) {
+        }
+        throw std::invalid_argument("Expected a non-negative number in " + argument);
+    }
+}
+
+const char* Game_Settings::usage() {
+    return "Usage: Battle-Arena [options]\n"
+           "  --render-thread   draw and display() on a separate thread from the simulation\n"
+           "  --vsync           wait for the display refresh in display() (default)\n"
+           "  --fps=N           no vsync, limit to N frames per second\n"
+           "  --uncapped        no vsync and no limiter\n"
+           "  --frame-stats     print CPU and present times every few seconds\n"
+           "  --grid=N          play on an N x N tile arena, 8 to 20000 (default 100)\n"
+           "  --time-scale=X    run the simulation X times faster than real time (default 1, up to 100)\n"
+           "  --players=N       split the screen between N local players (default 2, up to 4)\n";
+}
+
+const char* Headless_Settings::usage() {
+    return "Usage: Headless-Arena [options]\n"
+           "  --matches=N       play N matches back to back (default 100)\n"
+           "  --grid=N          play on an N x N tile arena, 8 to 20000 (default 100)\n"
+           "  --max-ticks=N     call a match a timeout after N steps (default 5 minutes of game time)\n"
+           "  --seed=N          seed of the first match, match i uses N + i (default random)\n"
+           "  --threads=N       play matches on N worker threads (default one per core)\n"
+           "  --output=FILE     write one line per match (winner, duration, territory curve) to FILE\n"
+           "  --curve-step=N    sample the territory curve every N steps (default 240, one second)\n"
+           "  --players=N       put N players in every match (default 2, up to 8)\n";
+}
+
+Game_Settings Game_Settings::fromArguments(int argc, char* argv[]) {
+    Game_Settings settings;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--help") {
+            settings.help = true;
+        } else if (argument == "--render-thread") {
+            settings.renderThread = true;
+        } else if (argument == "--vsync") {
+            settings.pacing = Frame_Pacing::VSync;
+        } else if (argument == "--uncapped") {
+            settings.pacing = Frame_Pacing::Uncapped;
+        } else if (!optionValue(argument, "--fps").empty()) {
+            settings.pacing = Frame_Pacing::FixedRate;
+            settings.targetFps = parsePositive(optionValue(argument, "--fps"), argument);
+        } else if (argument == "--frame-stats") {
+            settings.frameStats = true;
+        } else if (!optionValue(argument, "--grid").empty()) {
+            settings.gridSize = parseGridSize(optionValue(argument, "--grid"), argument);
+        } else if (!optionValue(argument, "--time-scale").empty()) {
+            settings.timeScale = parseTimeScale(optionValue(argument, "--time-scale"), argument);
+        } else if (!optionValue(argument, "--players").empty()) {
+            settings.players = parsePlayers(optionValue(argument, "--players"), argument, MaxPlayers);
+        } else {
+            throw std::invalid_argument("Unknown option " + argument);
+        }
+    }
+    return settings;
+}
+
+Headless_Settings Headless_Settings::fromArguments(int argc, char* argv[]) {
+    Headless_Settings settings;
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--help") {
+            settings.help = true;
+        } else if (!optionValue(argument, "--matches").empty()) {
+            settings.matches = parsePositive(optionValue(argument, "--matches"), argument);
+        } else if (!optionValue(argument, "--grid").empty()) {
+            settings.gridSize = parseGridSize(optionValue(argument, "--grid"), argument);
+        } else if (!optionValue(argument, "--max-ticks").empty()) {
+            settings.maxTicks = parsePositive(optionValue(argument, "--max-ticks"), argument);
+        } else if (!optionValue(argument, "--seed").empty()) {
+            settings.seed = parseUnsigned(optionValue(argument, "--seed"), argument);
+            settings.fixedSeed = true;
+        } else if (!optionValue(argument, "--threads").empty()) {
+            settings.threads = parsePositive(optionValue(argument, "--threads"), argument);
+        } else if (!optionValue(argument, "--output").empty()) {
+            settings.outputPath = optionValue(argument, "--output");
+        } else if (!optionValue(argument, "--curve-step").empty()) {
+            settings.curveStep = parsePositive(optionValue(argument, "--curve-step"), argument);
+        } else if (!optionValue(argument, "--players").empty()) {
+            settings.players = parsePlayers(optionValue(argument, "--players"), argument, MaxPlayers);
+        } else {
+            throw std::invalid_argument("Unknown option " + argument);
+        }
+    }
+    return settings;
+}
@@ -0,0 +1,67 @@
+#ifndef GAME_SETTINGS_H
+#define GAME_SETTINGS_H
+
+#include <cstdint>
+#include <string>
+
+enum class Frame_Pacing {
+    VSync,
+    FixedRate,
+    Uncapped
+};
+
+// Startup options, read from the command line. fromArguments throws
+// std::invalid_argument for an unknown option or a bad value.
+//   --help            print the options below and exit
+//   --render-thread   draw and display() on a separate thread from the simulation
+//   --vsync           wait for the display refresh in display() (default)
+//   --fps=N           no vsync, limit to N frames per second with a sleep-and-spin limiter
+//   --uncapped        no vsync and no limiter
+//   --frame-stats     print CPU and present times every few seconds
+//   --grid=N          play on an N x N tile arena, 8 to 20000 (default 100)
+//   --time-scale=X    run the simulation X times faster than real time (default 1, up to 100)
+//   --players=N       split the screen between N local players (default 2, up to 4)
+struct Game_Settings {
+    static constexpr int MaxPlayers = 4;
+
+    bool renderThread = false;
+    Frame_Pacing pacing = Frame_Pacing::VSync;
+    unsigned int targetFps = 60;
+    bool frameStats = false;
+    int gridSize = 100;
+    float timeScale = 1.0f;
+    int players = 2;
+    bool help = false;
+
+    static Game_Settings fromArguments(int argc, char* argv[]);
+    static const char* usage();
+};
+
+// Options of the headless match runner, read and checked as Game_Settings.
+//   --help            print the options below and exit
+//   --matches=N       play N matches back to back (default 100)
+//   --grid=N          play on an N x N tile arena, 8 to 20000 (default 100)
+//   --max-ticks=N     call a match a timeout after N steps (default 5 minutes of game time)
+//   --seed=N          seed of the first match, match i uses N + i (default random)
+//   --threads=N       play matches on N worker threads (default one per core)
+//   --output=FILE     write one line per match (winner, duration, territory curve) to FILE
+//   --curve-step=N    sample the territory curve every N steps (default 240, one second)
+//   --players=N       put N players in every match (default 2, up to 8)
+struct Headless_Settings {
+    static constexpr int MaxPlayers = 8;
+    unsigned int matches = 100;
+    int gridSize = 100;
+    std::uint64_t maxTicks = 240 * 60 * 5;
+    std::uint64_t seed = 0;
+    bool fixedSeed = false;
+    unsigned int threads = 0;
+    std::string outputPath;
+    unsigned int curveStep = 240;
+    int players = 2;
+    bool help = false;
+
+    static Headless_Settings fromArguments(int argc, char* argv[]);
+    static const char* usage();
+};
+
+#endif // GAME_SETTINGS_H
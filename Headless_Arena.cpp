@@ -0,0 +1,25 @@
+#include <iostream>
+#include <stdexcept>
+#include "Game_Settings.h"
+#include "Simulation/Headless_Runner.h"
+int main(int argc, char* argv[]) {
+    Headless_Settings settings;
+    try {
+        settings = Headless_Settings::fromArguments(argc, argv);
+    } catch (std::invalid_argument& e) {
+        std::cerr << e.what() << '\n' << Headless_Settings::usage();
+        return 1;
+    }
+    if (settings.help) {
+        std::cout << Headless_Settings::usage();
+        return 0;
+    }
+    Headless_Runner runner(settings);
+    try {
+        std::cout << runner.run() << std::endl;
+    } catch (std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
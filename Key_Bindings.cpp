@@ -0,0 +1,80 @@
+#include "Key_Bindings.h"
+
+#include <stdexcept>
+#include <string>
+
+Key_Bindings Key_Bindings::Default() {
+    using Key = sf::Keyboard::Key;
+    Key_Bindings bindings;
+    bindings.bind(Key::W, 0, Player_Action::Up);
+    bindings.bind(Key::S, 0, Player_Action::Down);
+    bindings.bind(Key::A, 0, Player_Action::Left);
+    bindings.bind(Key::D, 0, Player_Action::Right);
+    bindings.bind(Key::E, 0, Player_Action::Launch);
+    bindings.bind(Key::Space, 0, Player_Action::Paint);
+    bindings.bind(Key::Z, 0, Player_Action::ZoomIn);
+    bindings.bind(Key::X, 0, Player_Action::ZoomOut);
+    bindings.bind(Key::Up, 1, Player_Action::Up);
+    bindings.bind(Key::Down, 1, Player_Action::Down);
+    bindings.bind(Key::Left, 1, Player_Action::Left);
+    bindings.bind(Key::Right, 1, Player_Action::Right);
+    bindings.bind(Key::RShift, 1, Player_Action::Launch);
+    bindings.bind(Key::RControl, 1, Player_Action::Paint);
+    bindings.bind(Key::O, 1, Player_Action::ZoomIn);
+    bindings.bind(Key::P, 1, Player_Action::ZoomOut);
+    bindings.bind(Key::I, 2, Player_Action::Up);
+    bindings.bind(Key::K, 2, Player_Action::Down);
+    bindings.bind(Key::J, 2, Player_Action::Left);
+    bindings.bind(Key::L, 2, Player_Action::Right);
+    bindings.bind(Key::U, 2, Player_Action::Launch);
+    bindings.bind(Key::Y, 2, Player_Action::Paint);
+    bindings.bind(Key::N, 2, Player_Action::ZoomIn);
+    bindings.bind(Key::M, 2, Player_Action::ZoomOut);
+    bindings.bind(Key::Numpad8, 3, Player_Action::Up);
+    bindings.bind(Key::Numpad5, 3, Player_Action::Down);
+    bindings.bind(Key::Numpad4, 3, Player_Action::Left);
+    bindings.bind(Key::Numpad6, 3, Player_Action::Right);
+    bindings.bind(Key::Numpad7, 3, Player_Action::Launch);
+    bindings.bind(Key::Numpad9, 3, Player_Action::Paint);
+    bindings.bind(Key::Add, 3, Player_Action::ZoomIn);
+    bindings.bind(Key::Subtract, 3, Player_Action::ZoomOut);
+    return bindings;
+}
+
+bool Key_Bindings::inRange(sf::Keyboard::Key key) {
+    int code = static_cast<int>(key);
+    return code >= 0 && code < static_cast<int>(sf::Keyboard::KeyCount);
+}
+
+void Key_Bindings::bind(sf::Keyboard::Key key, int player, Player_Action action) {
+    if (!inRange(key)) {
+        throw std::invalid_argument("Cannot bind an unknown key");
+    }
+    if (player < 0 || player >= Input_Words::MaxPlayers) {
+        throw std::invalid_argument("Cannot bind a key to player " + std::to_string(player + 1));
+    }
+    table[static_cast<std::size_t>(key)] = {static_cast<std::int8_t>(player), action};
+}
+
+void Key_Bindings::unbind(sf::Keyboard::Key key) {
+    if (inRange(key)) {
+        table[static_cast<std::size_t>(key)] = Binding();
+    }
+}
+
+void Key_Bindings::apply(Input_Word& inputs, sf::Keyboard::Key key, bool pressed) const {
+    if (!inRange(key)) {
+        return;
+    }
+    const Binding& binding = table[static_cast<std::size_t>(key)];
+    if (binding.player < 0) {
+        return;
+    }
+    bool oneShot = (actionBit(binding.action) & Player_Input::OneShotBits) != 0;
+    if (oneShot && !pressed) {
+        return;
+    }
+    Player_Input input = Input_Words::get(inputs, binding.player);
+    input.set(binding.action, pressed);
+    inputs = Input_Words::set(inputs, binding.player, input);
+}
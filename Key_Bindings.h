@@ -0,0 +1,37 @@
+#ifndef KEY_BINDINGS_H
+#define KEY_BINDINGS_H
+
+#include <SFML/Window.hpp>
+#include <array>
+#include <cstdint>
+#include "Simulation/Player_Input.h"
+
+// Which player and action each key stands for, looked up by key code in a
+// flat table. Key events are turned into bits of an Input_Word here, so
+// the game loop never looks at individual keys.
+class Key_Bindings {
+    struct Binding {
+        std::int8_t player = -1;
+        Player_Action action = Player_Action::Up;
+    };
+
+    std::array<Binding, sf::Keyboard::KeyCount> table{};
+
+    static bool inRange(sf::Keyboard::Key key);
+
+public:
+    // WASD, E to launch, Space to paint and Z/X to zoom for player 1; the
+    // arrows, RShift, RControl and O/P for player 2; IJKL, U, Y and N/M for
+    // player 3; numpad 8456, 7, 9 and +/- for player 4.
+    static Key_Bindings Default();
+
+    // Binds key to one player's action, replacing whatever it was bound to.
+    void bind(sf::Keyboard::Key key, int player, Player_Action action);
+    void unbind(sf::Keyboard::Key key);
+
+    // Held actions follow the key; one-shot actions are only set on press
+    // and stay set until the caller clears them.
+    void apply(Input_Word& inputs, sf::Keyboard::Key key, bool pressed) const;
+};
+
+#endif // KEY_BINDINGS_H
@@ -0,0 +1,68 @@
+#include "Player_Sprite.h"
+#include "Frame_Snapshot.h"
+
+sf::IntRect Player_Sprite::getFrameRect(int row, int col) const {
+    return sf::IntRect({sheetOrigin.x + col * m_frameSize, sheetOrigin.y + row * m_frameSize}, {m_frameSize, m_frameSize});
+}
+
+void Player_Sprite::setupAnimationFrames() {
+    animationFrames[AnimDown]      = { getFrameRect(0,0), getFrameRect(0,1), getFrameRect(0,2), getFrameRect(0,3) };
+    animationFrames[AnimDownRight] = { getFrameRect(0,4), getFrameRect(0,5), getFrameRect(0,6), getFrameRect(0,7) };
+    animationFrames[AnimRight]     = { getFrameRect(0,8), getFrameRect(1,0), getFrameRect(1,1), getFrameRect(1,2) };
+    animationFrames[AnimUpRight]   = { getFrameRect(1,7), getFrameRect(1,8), getFrameRect(2,0), getFrameRect(2,1) };
+    animationFrames[AnimUp]        = { getFrameRect(1,3), getFrameRect(1,4), getFrameRect(1,5), getFrameRect(1,6) };
+    animationFrames[AnimDownLeft]  = animationFrames[AnimDownRight];
+    animationFrames[AnimLeft]      = animationFrames[AnimRight];
+    animationFrames[AnimUpLeft]    = animationFrames[AnimUpRight];
+}
+
+void Player_Sprite::setSheet(const sf::Texture* sheetTexture, sf::Vector2i origin, sf::Color sheetTint) {
+    texture = sheetTexture;
+    sheetOrigin = origin;
+    tint = sheetTint;
+    setupAnimationFrames();
+    currentFrame = 0;
+    frameStartTick = 0;
+}
+
+sf::IntRect Player_Sprite::getCurrentFrame() const {
+    const std::vector<sf::IntRect>& frames = animationFrames[currentDirection];
+    if (frames.empty()) {
+        return sf::IntRect({sheetOrigin.x, sheetOrigin.y}, {m_frameSize, m_frameSize});
+    }
+    return frames[currentFrame % frames.size()];
+}
+
+void Player_Sprite::animate(const Player_Pose& pose, Sim_Time::Tick tick) {
+    if (pose.direction != currentDirection) {
+        currentDirection = pose.direction;
+        currentFrame = 0;
+    }
+    if (!pose.moving) {
+        currentFrame = 0;
+        frameStartTick = tick;
+    } else if (tick - frameStartTick >= animationFrameTicks) {
+        if (!animationFrames[currentDirection].empty()) {
+            currentFrame = (currentFrame + 1) % animationFrames[currentDirection].size();
+        }
+        frameStartTick = tick;
+    }
+}
+
+void Player_Sprite::draw(sf::RenderTarget& target, const Player_Pose& pose) const {
+    if (pose.eliminated || !texture) {
+        return;
+    }
+    float scaleFactor = Player::getSpriteSize() / static_cast<float>(m_frameSize);
+    sf::Sprite sprite(*texture, getCurrentFrame());
+    sprite.setOrigin({static_cast<float>(m_frameSize) / 2.0f, static_cast<float>(m_frameSize) / 2.0f});
+    sprite.setScale({pose.facingLeft ? -scaleFactor : scaleFactor, scaleFactor});
+    sprite.setPosition(pose.position);
+    sprite.setColor(tint);
+    target.draw(sprite);
+}
+
+sf::FloatRect Player_Sprite::getBounds(const Player_Pose& pose) {
+    float size = Player::getSpriteSize();
+    return sf::FloatRect({pose.position.x - size / 2.0f, pose.position.y - size / 2.0f}, {size, size});
+}
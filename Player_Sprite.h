@@ -0,0 +1,37 @@
+#ifndef PLAYER_SPRITE_H
+#define PLAYER_SPRITE_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+#include "Player.h"
+
+struct Player_Pose;
+
+// Render side of a player: the sprite sheet and the walk animation. The
+// animation is timed in simulation ticks, so it follows pause and time scale.
+class Player_Sprite {
+    const sf::Texture* texture = nullptr;
+    sf::Vector2i sheetOrigin = {0, 0};
+    sf::Color tint = sf::Color::White;
+    std::array<std::vector<sf::IntRect>, AnimCount> animationFrames;
+    Sim_Time::Tick frameStartTick = 0;
+    Sim_Time::Tick animationFrameTicks = Sim_Time::ticks(1.0f / 10.0f);
+    std::size_t currentFrame = 0;
+    AnimationDirection currentDirection = AnimDown;
+
+    static constexpr int m_frameSize = 128;
+
+    sf::IntRect getFrameRect(int row, int col) const;
+    void setupAnimationFrames();
+    sf::IntRect getCurrentFrame() const;
+
+public:
+    // Players sharing a sheet are told apart by tint.
+    void setSheet(const sf::Texture* sheetTexture, sf::Vector2i origin, sf::Color sheetTint = sf::Color::White);
+    void animate(const Player_Pose& pose, Sim_Time::Tick tick);
+    void draw(sf::RenderTarget& target, const Player_Pose& pose) const;
+    static sf::FloatRect getBounds(const Player_Pose& pose);
+};
+
+#endif // PLAYER_SPRITE_H
@@ -7,11 +7,20 @@
 #include <memory>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
+#include <algorithm>
 
 template <typename T>
 class Resource_Manager {
     std::map<std::string, std::unique_ptr<T>> resources;
 
+    // Atlas mode (textures only): images registered before buildAtlas() are
+    // packed into one texture and looked up by name as sub-rectangles.
+    static constexpr unsigned int AtlasPadding = 2;
+    std::map<std::string, sf::Image> pendingAtlasImages;
+    std::map<std::string, sf::IntRect> atlasRegions;
+    std::unique_ptr<sf::Texture> atlasTexture;
+
     Resource_Manager() = default;
 
 public:
@@ -45,6 +54,107 @@ public:
         }
         return *resources[filePath];
     }
+
+    void registerAtlasImage(const std::string& filePath) {
+        static_assert(std::is_same_v<T, sf::Texture>, "Only textures can be packed into an atlas");
+        sf::Image image;
+        if (!image.loadFromFile(filePath)) {
+            throw std::runtime_error("Failed to load atlas image from file " + filePath);
+        }
+        registerAtlasImage(filePath, image);
+    }
+
+    void registerAtlasImage(const std::string& name, const sf::Image& image) {
+        static_assert(std::is_same_v<T, sf::Texture>, "Only textures can be packed into an atlas");
+        if (atlasTexture) {
+            throw std::runtime_error("Atlas already built, cannot register " + name);
+        }
+        pendingAtlasImages[name] = image;
+    }
+
+    // Shelf packing: tallest images first, rows as wide as the widest image
+    // or the square root of the total area, whichever is larger.
+    void buildAtlas() {
+        static_assert(std::is_same_v<T, sf::Texture>, "Only textures can be packed into an atlas");
+        if (pendingAtlasImages.empty()) {
+            throw std::runtime_error("No images registered for the atlas");
+        }
+
+        std::vector<const std::pair<const std::string, sf::Image>*> order;
+        unsigned int widest = 0;
+        unsigned long long totalArea = 0;
+        for (const auto& entry : pendingAtlasImages) {
+            order.push_back(&entry);
+            sf::Vector2u size = entry.second.getSize();
+            widest = std::max(widest, size.x + AtlasPadding);
+            totalArea += static_cast<unsigned long long>(size.x + AtlasPadding) * (size.y + AtlasPadding);
+        }
+        std::sort(order.begin(), order.end(), [](const auto* a, const auto* b) {
+            return a->second.getSize().y > b->second.getSize().y;
+        });
+
+        unsigned int maxSize = sf::Texture::getMaximumSize();
+        unsigned int shelfWidth = 1;
+        while (static_cast<unsigned long long>(shelfWidth) * shelfWidth < totalArea) {
+            shelfWidth *= 2;
+        }
+        shelfWidth = std::min(std::max(shelfWidth, widest), maxSize);
+
+        std::map<std::string, sf::IntRect> regions;
+        sf::Vector2u cursor = {0, 0};
+        unsigned int shelfHeight = 0;
+        unsigned int usedWidth = 0;
+        for (const auto* entry : order) {
+            sf::Vector2u size = entry->second.getSize();
+            if (cursor.x + size.x > shelfWidth) {
+                cursor = {0, cursor.y + shelfHeight};
+                shelfHeight = 0;
+            }
+            regions[entry->first] = sf::IntRect(sf::Vector2i(cursor), sf::Vector2i(size));
+            cursor.x += size.x + AtlasPadding;
+            usedWidth = std::max(usedWidth, cursor.x);
+            shelfHeight = std::max(shelfHeight, size.y + AtlasPadding);
+        }
+        sf::Vector2u atlasSize = {usedWidth, cursor.y + shelfHeight};
+        if (atlasSize.x > maxSize || atlasSize.y > maxSize) {
+            throw std::runtime_error("Atlas images do not fit in a single texture");
+        }
+
+        sf::Image atlasImage(atlasSize, sf::Color::Transparent);
+        for (const auto* entry : order) {
+            if (!atlasImage.copy(entry->second, sf::Vector2u(regions[entry->first].position))) {
+                throw std::runtime_error("Failed to copy " + entry->first + " into the atlas");
+            }
+        }
+
+        std::unique_ptr<sf::Texture> texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(atlasImage)) {
+            throw std::runtime_error("Failed to create the atlas texture");
+        }
+        atlasTexture = std::move(texture);
+        atlasRegions = std::move(regions);
+        pendingAtlasImages.clear();
+    }
+
+    bool hasAtlas() const {
+        return atlasTexture != nullptr;
+    }
+
+    T& getAtlasTexture() {
+        static_assert(std::is_same_v<T, sf::Texture>, "Only textures can be packed into an atlas");
+        if (!atlasTexture) {
+            throw std::runtime_error("Atlas has not been built");
+        }
+        return *atlasTexture;
+    }
+
+    sf::IntRect getAtlasRegion(const std::string& name) const {
+        auto it = atlasRegions.find(name);
+        if (it == atlasRegions.end()) {
+            throw std::runtime_error("No atlas region named " + name);
+        }
+        return it->second;
+    }
 };
 
-#endif // RESOURCE_MANAGER_H
\ No newline at end of file
+#endif // RESOURCE_MANAGER_H
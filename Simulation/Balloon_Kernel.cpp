@@ -0,0 +1,239 @@
+#include "Balloon_Kernel.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BALLOON_KERNEL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(BALLOON_KERNEL_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define BALLOON_KERNEL_AVX2 1
+#include <immintrin.h>
+#define BALLOON_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace {
+    int targetSlot(int targetIndex, int playerCount) {
+        return (targetIndex >= 0 && targetIndex < playerCount) ? targetIndex + 1 : 0;
+    }
+
+    // The reference: every vector path must match this bit for bit.
+    void updateScalar(const Balloon_Lanes& lanes, const Balloon_Targets& targets, const Balloon_Motion& motion,
+                      float deltaTime, std::size_t begin) {
+        for (std::size_t i = begin; i < lanes.count; ++i) {
+            int slot = targetSlot(lanes.targetIndex[i], targets.playerCount);
+
+            float trackingX = 0.0f;
+            float trackingY = 0.0f;
+            if (slot != 0 && targets.tracking[slot] != 0.0f) {
+                float directionX = targets.x[slot] - lanes.positionX[i];
+                float directionY = targets.y[slot] - lanes.positionY[i];
+                float distanceToTarget = std::sqrt(directionX * directionX + directionY * directionY);
+                if (distanceToTarget != 0.0f) {
+                    trackingX = directionX / distanceToTarget * motion.trackingSpeed;
+                    trackingY = directionY / distanceToTarget * motion.trackingSpeed;
+                }
+            }
+
+            float attenuationFactor = 0.0f;
+            float age = static_cast<float>(lanes.ageTicks[i]) * deltaTime;
+            if (age < motion.launchDuration) {
+                float remaining = 1.0f - age / motion.launchDuration;
+                attenuationFactor = remaining * std::sqrt(remaining);
+            }
+
+            float vx = lanes.launchX[i] * attenuationFactor + trackingX;
+            float vy = lanes.launchY[i] * attenuationFactor + trackingY;
+
+            float speed = std::sqrt(vx * vx + vy * vy);
+            if (speed > motion.maxSpeed) {
+                vx = vx / speed * motion.maxSpeed;
+                vy = vy / speed * motion.maxSpeed;
+            } else if ((attenuationFactor == 0.0f && speed < 1.0f) || slot == 0) {
+                vx = 0.0f;
+                vy = 0.0f;
+            }
+
+            lanes.velocityX[i] = vx;
+            lanes.velocityY[i] = vy;
+            lanes.positionX[i] += vx * deltaTime;
+            lanes.positionY[i] += vy * deltaTime;
+            lanes.ageTicks[i] += 1;
+        }
+    }
+
+#ifdef BALLOON_KERNEL_SSE2
+    inline __m128 select(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+        return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+    }
+
+    std::size_t updateSSE2(const Balloon_Lanes& lanes, const Balloon_Targets& targets, const Balloon_Motion& motion, float deltaTime) {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 trackingSpeed = _mm_set1_ps(motion.trackingSpeed);
+        const __m128 maxSpeed = _mm_set1_ps(motion.maxSpeed);
+        const __m128 launchDuration = _mm_set1_ps(motion.launchDuration);
+        const __m128 dt = _mm_set1_ps(deltaTime);
+        const __m128i oneTick = _mm_set1_epi32(1);
+
+        std::size_t i = 0;
+        for (; i + 4 <= lanes.count; i += 4) {
+            // No gather before AVX2: the four target lookups are done one by one.
+            int slots[4];
+            for (int lane = 0; lane < 4; ++lane) {
+                slots[lane] = targetSlot(lanes.targetIndex[i + lane], targets.playerCount);
+            }
+            __m128 targetX = _mm_setr_ps(targets.x[slots[0]], targets.x[slots[1]], targets.x[slots[2]], targets.x[slots[3]]);
+            __m128 targetY = _mm_setr_ps(targets.y[slots[0]], targets.y[slots[1]], targets.y[slots[2]], targets.y[slots[3]]);
+            __m128 tracking = _mm_setr_ps(targets.tracking[slots[0]], targets.tracking[slots[1]], targets.tracking[slots[2]], targets.tracking[slots[3]]);
+            __m128 noTarget = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_setr_epi32(slots[0], slots[1], slots[2], slots[3]), _mm_setzero_si128()));
+
+            __m128 positionX = _mm_loadu_ps(lanes.positionX + i);
+            __m128 positionY = _mm_loadu_ps(lanes.positionY + i);
+            __m128 directionX = _mm_sub_ps(targetX, positionX);
+            __m128 directionY = _mm_sub_ps(targetY, positionY);
+            __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(directionX, directionX), _mm_mul_ps(directionY, directionY)));
+            __m128 homing = _mm_andnot_ps(noTarget, _mm_and_ps(_mm_cmpneq_ps(tracking, zero), _mm_cmpneq_ps(distance, zero)));
+            __m128 trackingX = _mm_and_ps(homing, _mm_mul_ps(_mm_div_ps(directionX, distance), trackingSpeed));
+            __m128 trackingY = _mm_and_ps(homing, _mm_mul_ps(_mm_div_ps(directionY, distance), trackingSpeed));
+
+            __m128i ageTicks = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes.ageTicks + i));
+            __m128 age = _mm_mul_ps(_mm_cvtepi32_ps(ageTicks), dt);
+            __m128 launching = _mm_cmplt_ps(age, launchDuration);
+            __m128 remaining = _mm_sub_ps(one, _mm_div_ps(age, launchDuration));
+            __m128 attenuation = _mm_and_ps(launching, _mm_mul_ps(remaining, _mm_sqrt_ps(_mm_max_ps(remaining, zero))));
+
+            __m128 vx = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(lanes.launchX + i), attenuation), trackingX);
+            __m128 vy = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(lanes.launchY + i), attenuation), trackingY);
+            __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+
+            __m128 tooFast = _mm_cmpgt_ps(speed, maxSpeed);
+            __m128 stopped = _mm_andnot_ps(tooFast, _mm_or_ps(_mm_and_ps(_mm_cmpeq_ps(attenuation, zero), _mm_cmplt_ps(speed, one)), noTarget));
+            vx = _mm_andnot_ps(stopped, select(tooFast, _mm_mul_ps(_mm_div_ps(vx, speed), maxSpeed), vx));
+            vy = _mm_andnot_ps(stopped, select(tooFast, _mm_mul_ps(_mm_div_ps(vy, speed), maxSpeed), vy));
+
+            _mm_storeu_ps(lanes.velocityX + i, vx);
+            _mm_storeu_ps(lanes.velocityY + i, vy);
+            _mm_storeu_ps(lanes.positionX + i, _mm_add_ps(positionX, _mm_mul_ps(vx, dt)));
+            _mm_storeu_ps(lanes.positionY + i, _mm_add_ps(positionY, _mm_mul_ps(vy, dt)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.ageTicks + i), _mm_add_epi32(ageTicks, oneTick));
+        }
+        return i;
+    }
+#endif
+
+#ifdef BALLOON_KERNEL_AVX2
+    BALLOON_KERNEL_TARGET_AVX2
+    std::size_t updateAVX2(const Balloon_Lanes& lanes, const Balloon_Targets& targets, const Balloon_Motion& motion, float deltaTime) {
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 trackingSpeed = _mm256_set1_ps(motion.trackingSpeed);
+        const __m256 maxSpeed = _mm256_set1_ps(motion.maxSpeed);
+        const __m256 launchDuration = _mm256_set1_ps(motion.launchDuration);
+        const __m256 dt = _mm256_set1_ps(deltaTime);
+        const __m256i oneTick = _mm256_set1_epi32(1);
+        const __m256i firstPlayerSlot = _mm256_set1_epi32(1);
+        const __m256i slotCount = _mm256_set1_epi32(targets.playerCount + 1);
+
+        std::size_t i = 0;
+        for (; i + 8 <= lanes.count; i += 8) {
+            __m256i slot = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes.targetIndex + i)), firstPlayerSlot);
+            __m256i validSlot = _mm256_and_si256(_mm256_cmpgt_epi32(slot, _mm256_setzero_si256()), _mm256_cmpgt_epi32(slotCount, slot));
+            slot = _mm256_and_si256(slot, validSlot);
+            __m256 noTarget = _mm256_castsi256_ps(_mm256_cmpeq_epi32(slot, _mm256_setzero_si256()));
+            __m256 targetX = _mm256_i32gather_ps(targets.x, slot, 4);
+            __m256 targetY = _mm256_i32gather_ps(targets.y, slot, 4);
+            __m256 tracking = _mm256_i32gather_ps(targets.tracking, slot, 4);
+
+            __m256 positionX = _mm256_loadu_ps(lanes.positionX + i);
+            __m256 positionY = _mm256_loadu_ps(lanes.positionY + i);
+            __m256 directionX = _mm256_sub_ps(targetX, positionX);
+            __m256 directionY = _mm256_sub_ps(targetY, positionY);
+            __m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(directionX, directionX), _mm256_mul_ps(directionY, directionY)));
+            __m256 homing = _mm256_andnot_ps(noTarget, _mm256_and_ps(_mm256_cmp_ps(tracking, zero, _CMP_NEQ_UQ), _mm256_cmp_ps(distance, zero, _CMP_NEQ_UQ)));
+            __m256 trackingX = _mm256_and_ps(homing, _mm256_mul_ps(_mm256_div_ps(directionX, distance), trackingSpeed));
+            __m256 trackingY = _mm256_and_ps(homing, _mm256_mul_ps(_mm256_div_ps(directionY, distance), trackingSpeed));
+
+            __m256i ageTicks = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes.ageTicks + i));
+            __m256 age = _mm256_mul_ps(_mm256_cvtepi32_ps(ageTicks), dt);
+            __m256 launching = _mm256_cmp_ps(age, launchDuration, _CMP_LT_OQ);
+            __m256 remaining = _mm256_sub_ps(one, _mm256_div_ps(age, launchDuration));
+            __m256 attenuation = _mm256_and_ps(launching, _mm256_mul_ps(remaining, _mm256_sqrt_ps(_mm256_max_ps(remaining, zero))));
+
+            __m256 vx = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(lanes.launchX + i), attenuation), trackingX);
+            __m256 vy = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(lanes.launchY + i), attenuation), trackingY);
+            __m256 speed = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)));
+
+            __m256 tooFast = _mm256_cmp_ps(speed, maxSpeed, _CMP_GT_OQ);
+            __m256 slow = _mm256_and_ps(_mm256_cmp_ps(attenuation, zero, _CMP_EQ_OQ), _mm256_cmp_ps(speed, one, _CMP_LT_OQ));
+            __m256 stopped = _mm256_andnot_ps(tooFast, _mm256_or_ps(slow, noTarget));
+            vx = _mm256_andnot_ps(stopped, _mm256_blendv_ps(vx, _mm256_mul_ps(_mm256_div_ps(vx, speed), maxSpeed), tooFast));
+            vy = _mm256_andnot_ps(stopped, _mm256_blendv_ps(vy, _mm256_mul_ps(_mm256_div_ps(vy, speed), maxSpeed), tooFast));
+
+            _mm256_storeu_ps(lanes.velocityX + i, vx);
+            _mm256_storeu_ps(lanes.velocityY + i, vy);
+            _mm256_storeu_ps(lanes.positionX + i, _mm256_add_ps(positionX, _mm256_mul_ps(vx, dt)));
+            _mm256_storeu_ps(lanes.positionY + i, _mm256_add_ps(positionY, _mm256_mul_ps(vy, dt)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes.ageTicks + i), _mm256_add_epi32(ageTicks, oneTick));
+        }
+        return i;
+    }
+#endif
+}
+
+namespace Balloon_Kernel {
+    bool isSupported(Path path) {
+        switch (path) {
+            case Path::Scalar:
+                return true;
+            case Path::SSE2:
+#ifdef BALLOON_KERNEL_SSE2
+                return true;
+#else
+                return false;
+#endif
+            case Path::AVX2:
+#ifdef BALLOON_KERNEL_AVX2
+                return __builtin_cpu_supports("avx2");
+#else
+                return false;
+#endif
+        }
+        return false;
+    }
+
+    Path bestPath() {
+        if (isSupported(Path::AVX2)) {
+            return Path::AVX2;
+        }
+        if (isSupported(Path::SSE2)) {
+            return Path::SSE2;
+        }
+        return Path::Scalar;
+    }
+
+    const char* getName(Path path) {
+        switch (path) {
+            case Path::Scalar: return "scalar";
+            case Path::SSE2: return "SSE2";
+            case Path::AVX2: return "AVX2";
+        }
+        return "unknown";
+    }
+
+    void update(const Balloon_Lanes& lanes, const Balloon_Targets& targets, const Balloon_Motion& motion, float deltaTime, Path path) {
+        std::size_t done = 0;
+#ifdef BALLOON_KERNEL_AVX2
+        if (path == Path::AVX2) {
+            done = updateAVX2(lanes, targets, motion, deltaTime);
+        }
+#endif
+#ifdef BALLOON_KERNEL_SSE2
+        if (path == Path::SSE2) {
+            done = updateSSE2(lanes, targets, motion, deltaTime);
+        }
+#endif
+        updateScalar(lanes, targets, motion, deltaTime, done);
+    }
+}
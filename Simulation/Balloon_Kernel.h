@@ -0,0 +1,57 @@
+#ifndef BALLOON_KERNEL_H
+#define BALLOON_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+// The balloon arrays one update works on, borrowed from Balloon_Pool.
+struct Balloon_Lanes {
+    float* positionX;
+    float* positionY;
+    float* velocityX;
+    float* velocityY;
+    const float* launchX;
+    const float* launchY;
+    // Whole steps since launch; deltaTime is the length of one.
+    std::int32_t* ageTicks;
+    // Index into the players, anything outside [0, playerCount) means none.
+    const int* targetIndex;
+    std::size_t count;
+};
+
+// Where each player is and whether balloons should home in on them. Slot 0
+// is "no target"; player i lives in slot i + 1.
+struct Balloon_Targets {
+    const float* x;
+    const float* y;
+    const float* tracking;
+    int playerCount;
+};
+
+struct Balloon_Motion {
+    float trackingSpeed;
+    float maxSpeed;
+    float launchDuration;
+};
+
+// Homing and integration of every balloon in one pass. The vector paths do
+// the same IEEE operations in the same order as the scalar one, and the
+// attenuation (1 - t)^1.5 is taken as (1 - t) * sqrt(1 - t), so every path
+// gives bit-identical results. Needs -ffp-contract=off on GCC and Clang so
+// the scalar path is not fused into FMAs.
+namespace Balloon_Kernel {
+    enum class Path {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    // Widest path this CPU and build support.
+    Path bestPath();
+    bool isSupported(Path path);
+    const char* getName(Path path);
+
+    void update(const Balloon_Lanes& lanes, const Balloon_Targets& targets, const Balloon_Motion& motion, float deltaTime, Path path);
+}
+
+#endif // BALLOON_KERNEL_H
@@ -0,0 +1,17 @@
+#include "Disc_Mask.h"
+
+#include <cmath>
+
+Disc_Mask::Disc_Mask(float radiusTiles) : radius(radiusTiles) {
+    float radiusSquared = radiusTiles * radiusTiles;
+    int reach = static_cast<int>(std::floor(radiusTiles));
+    for (int dy = -reach; dy <= reach; ++dy) {
+        int maxDx = 0;
+        while (static_cast<float>((maxDx + 1) * (maxDx + 1) + dy * dy) <= radiusSquared) {
+            ++maxDx;
+        }
+        if (static_cast<float>(dy * dy) <= radiusSquared) {
+            spans.push_back({dy, -maxDx, maxDx});
+        }
+    }
+}
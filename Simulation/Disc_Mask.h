@@ -0,0 +1,28 @@
+#ifndef DISC_MASK_H
+#define DISC_MASK_H
+
+#include <vector>
+
+// Footprint of a disc on the tile grid as one span per row: the tiles whose
+// centres lie within radius tiles of the centre of tile (0, 0). Built once
+// per radius, so painting is a handful of span writes instead of a distance
+// test per tile of the bounding square.
+class Disc_Mask {
+public:
+    struct Span {
+        int dy;
+        int minDx;
+        int maxDx;
+    };
+
+    explicit Disc_Mask(float radiusTiles);
+
+    float getRadius() const { return radius; }
+    const std::vector<Span>& getSpans() const { return spans; }
+
+private:
+    float radius;
+    std::vector<Span> spans;
+};
+
+#endif // DISC_MASK_H
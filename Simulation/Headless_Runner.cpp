@@ -0,0 +1,141 @@
+#include "Headless_Runner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include "Random_Input.h"
+
+double Headless_Report::matchesPerSecond() const {
+    return wallSeconds > 0.0 ? matches / wallSeconds : 0.0;
+}
+
+double Headless_Report::ticksPerSecond() const {
+    return wallSeconds > 0.0 ? ticks / wallSeconds : 0.0;
+}
+
+Headless_Runner::Headless_Runner(const Headless_Settings& settings) : settings(settings) {
+}
+
+Match_Result Headless_Runner::playMatch(std::uint64_t seed) const {
+    Simulation simulation(settings.gridSize, seed, settings.players);
+    std::vector<Random_Input> bots;
+    bots.reserve(settings.players);
+    for (int i = 0; i < settings.players; ++i) {
+        bots.emplace_back(static_cast<std::uint32_t>(seed * settings.players + i + 1));
+    }
+
+    Match_Result match;
+    match.seed = seed;
+    auto sampleTerritory = [&] {
+        std::vector<int>& owned = match.territory.emplace_back(settings.players);
+        for (int i = 0; i < settings.players; ++i) {
+            owned[i] = simulation.getOwnedTileCount(simulation.getPlayers()[i].getPlayerID());
+        }
+    };
+
+    while (!simulation.isFinished() && simulation.getTickCount() < settings.maxTicks) {
+        Simulation::Inputs inputs = 0;
+        for (std::size_t i = 0; i < bots.size(); ++i) {
+            inputs = Input_Words::set(inputs, static_cast<int>(i), bots[i].next());
+        }
+        simulation.step(inputs);
+        if (simulation.getTickCount() % settings.curveStep == 0) {
+            sampleTerritory();
+        }
+    }
+    if (simulation.getTickCount() % settings.curveStep != 0) {
+        sampleTerritory();
+    }
+    match.result = simulation.getResult();
+    match.ticks = simulation.getTickCount();
+    return match;
+}
+
+void Headless_Runner::writeResults(const std::vector<Match_Result>& results) const {
+    std::ofstream file(settings.outputPath);
+    if (!file) {
+        throw std::runtime_error("Failed to open " + settings.outputPath + " for writing");
+    }
+    file << "match,seed,winner,ticks,seconds,territory\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Match_Result& match = results[i];
+        file << i << ',' << match.seed << ',';
+        if (match.result == -1) {
+            file << "timeout";
+        } else if (match.result == 0) {
+            file << "draw";
+        } else {
+            file << match.result;
+        }
+        file << ',' << match.ticks << ',' << match.ticks * Simulation::StepSeconds << ',';
+        for (std::size_t sample = 0; sample < match.territory.size(); ++sample) {
+            if (sample > 0) {
+                file << ';';
+            }
+            for (std::size_t player = 0; player < match.territory[sample].size(); ++player) {
+                file << (player > 0 ? ":" : "") << match.territory[sample][player];
+            }
+        }
+        file << '\n';
+    }
+}
+
+Headless_Report Headless_Runner::run() const {
+    Headless_Report report;
+    std::uint64_t firstSeed = settings.fixedSeed ? settings.seed : Simulation::RandomSeed();
+    unsigned int threadCount = settings.threads > 0 ? settings.threads : std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, settings.matches);
+
+    std::vector<Match_Result> results(settings.matches);
+    std::atomic<unsigned int> nextMatch{0};
+    auto worker = [&] {
+        for (unsigned int i = nextMatch++; i < settings.matches; i = nextMatch++) {
+            results[i] = playMatch(firstSeed + i);
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : workers) {
+        thread.join();
+    }
+    report.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report.threads = threadCount;
+
+    report.wins.assign(settings.players, 0);
+    for (const Match_Result& match : results) {
+        report.ticks += match.ticks;
+        ++report.matches;
+        if (match.result == 0) {
+            ++report.draws;
+        } else if (match.result > 0) {
+            ++report.wins[match.result - 1];
+        } else {
+            ++report.timeouts;
+        }
+    }
+    if (!settings.outputPath.empty()) {
+        writeResults(results);
+    }
+    return report;
+}
+
+std::ostream& operator<<(std::ostream& os, const Headless_Report& report) {
+    os << "Matches: " << report.matches << " on " << report.threads << " threads |";
+    for (std::size_t i = 0; i < report.wins.size(); ++i) {
+        os << " Player " << i + 1 << " wins: " << report.wins[i] << ',';
+    }
+    os << " draws: " << report.draws
+       << ", timeouts: " << report.timeouts << '\n'
+       << "Ticks: " << report.ticks << " in " << report.wallSeconds << " s"
+       << " | " << report.matchesPerSecond() << " matches/sec"
+       << ", " << report.ticksPerSecond() << " ticks/sec";
+    return os;
+}
@@ -0,0 +1,49 @@
+#ifndef HEADLESS_RUNNER_H
+#define HEADLESS_RUNNER_H
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "../Game_Settings.h"
+#include "Simulation.h"
+
+struct Match_Result {
+    std::uint64_t seed = 0;
+    // As Simulation::getResult(), with -1 meaning the match hit the tick limit.
+    int result = -1;
+    std::uint64_t ticks = 0;
+    // Owned tiles per player, sampled every curve step and once at the end.
+    std::vector<std::vector<int>> territory;
+};
+
+struct Headless_Report {
+    unsigned int matches = 0;
+    unsigned int threads = 0;
+    // Indexed by player number - 1.
+    std::vector<unsigned int> wins;
+    unsigned int draws = 0;
+    unsigned int timeouts = 0;
+    std::uint64_t ticks = 0;
+    double wallSeconds = 0.0;
+
+    double matchesPerSecond() const;
+    double ticksPerSecond() const;
+};
+
+// Plays whole matches with random inputs and no window, as fast as the CPU
+// allows, for balance testing and for timing the simulation. Matches share
+// nothing, so each worker thread simply takes the next unplayed one.
+class Headless_Runner {
+    Headless_Settings settings;
+
+    Match_Result playMatch(std::uint64_t seed) const;
+    void writeResults(const std::vector<Match_Result>& results) const;
+
+public:
+    explicit Headless_Runner(const Headless_Settings& settings);
+    Headless_Report run() const;
+};
+
+std::ostream& operator<<(std::ostream& os, const Headless_Report& report);
+
+#endif // HEADLESS_RUNNER_H
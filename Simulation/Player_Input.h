@@ -0,0 +1,60 @@
+#ifndef PLAYER_INPUT_H
+#define PLAYER_INPUT_H
+
+#include <cstdint>
+
+// Everything a player can ask for. Movement is held state; the others are
+// one-shot requests seen by exactly one step. Zoom only matters to the
+// window the player is drawn in; the simulation ignores it.
+enum class Player_Action : std::uint8_t {
+    Up,
+    Down,
+    Left,
+    Right,
+    Launch,
+    Paint,
+    ZoomIn,
+    ZoomOut
+};
+
+constexpr std::uint8_t actionBit(Player_Action action) {
+    return static_cast<std::uint8_t>(1u << static_cast<unsigned>(action));
+}
+
+// What one player asks for during one simulation step, a bit per action.
+struct Player_Input {
+    static constexpr std::uint8_t OneShotBits = actionBit(Player_Action::Launch) | actionBit(Player_Action::Paint) |
+                                                actionBit(Player_Action::ZoomIn) | actionBit(Player_Action::ZoomOut);
+
+    std::uint8_t bits = 0;
+
+    bool has(Player_Action action) const { return (bits & actionBit(action)) != 0; }
+    void set(Player_Action action, bool on) {
+        bits = static_cast<std::uint8_t>(on ? bits | actionBit(action) : bits & ~actionBit(action));
+    }
+};
+
+// Every player's input for one step packed into one word, a byte per
+// player with player 0 in the low byte. A match is its seed plus one word
+// per tick, which is all it takes to record and replay it.
+using Input_Word = std::uint64_t;
+
+namespace Input_Words {
+    constexpr int MaxPlayers = 8;
+
+    inline Player_Input get(Input_Word word, int player) {
+        return Player_Input{static_cast<std::uint8_t>(word >> (8 * player))};
+    }
+
+    inline Input_Word set(Input_Word word, int player, Player_Input input) {
+        int shift = 8 * player;
+        return (word & ~(Input_Word{0xFF} << shift)) | (Input_Word{input.bits} << shift);
+    }
+
+    // Clears the given action bits for every player at once.
+    inline Input_Word clear(Input_Word word, std::uint8_t bits) {
+        return word & ~(Input_Word{bits} * 0x0101010101010101ull);
+    }
+}
+
+#endif // PLAYER_INPUT_H
@@ -0,0 +1,30 @@
+#include "Random_Input.h"
+
+namespace {
+    constexpr int MIN_HOLD_STEPS = 30;
+    constexpr int MAX_HOLD_STEPS = 240;
+    constexpr double LAUNCH_CHANCE = 1.0 / 120.0;
+    constexpr double PAINT_CHANCE = 1.0 / 60.0;
+}
+
+Random_Input::Random_Input(std::uint32_t seed) : rng(seed) {
+}
+
+Player_Input Random_Input::next() {
+    if (stepsLeft <= 0) {
+        std::uniform_int_distribution<int> axis(-1, 1);
+        int dx = axis(rng);
+        int dy = axis(rng);
+        held.set(Player_Action::Left, dx < 0);
+        held.set(Player_Action::Right, dx > 0);
+        held.set(Player_Action::Up, dy < 0);
+        held.set(Player_Action::Down, dy > 0);
+        stepsLeft = std::uniform_int_distribution<int>(MIN_HOLD_STEPS, MAX_HOLD_STEPS)(rng);
+    }
+    --stepsLeft;
+
+    Player_Input input = held;
+    input.set(Player_Action::Launch, std::bernoulli_distribution(LAUNCH_CHANCE)(rng));
+    input.set(Player_Action::Paint, std::bernoulli_distribution(PAINT_CHANCE)(rng));
+    return input;
+}
@@ -0,0 +1,20 @@
+#ifndef RANDOM_INPUT_H
+#define RANDOM_INPUT_H
+
+#include <cstdint>
+#include <random>
+#include "Player_Input.h"
+
+// Stand-in for a player in headless matches: walks in a random direction
+// for a random number of steps, and launches and paints at random.
+class Random_Input {
+    std::mt19937 rng;
+    Player_Input held;
+    int stepsLeft = 0;
+
+public:
+    explicit Random_Input(std::uint32_t seed);
+    Player_Input next();
+};
+
+#endif // RANDOM_INPUT_H
@@ -0,0 +1,27 @@
+#ifndef SIM_TIME_H
+#define SIM_TIME_H
+
+#include <cmath>
+#include <cstdint>
+
+// The simulation's only clock: a tick counter that advances by one per
+// step. Cooldowns, lifetimes and tick intervals are stored as tick counts
+// and compared as integers, so they stop when the simulation stops and run
+// as fast as it is stepped.
+namespace Sim_Time {
+    using Tick = std::uint64_t;
+
+    constexpr int TicksPerSecond = 240;
+    constexpr float StepSeconds = 1.0f / TicksPerSecond;
+
+    // Rounded to the nearest tick.
+    inline Tick ticks(float seconds) {
+        return static_cast<Tick>(std::lround(seconds * TicksPerSecond));
+    }
+
+    constexpr float seconds(Tick ticks) {
+        return static_cast<float>(ticks) * StepSeconds;
+    }
+}
+
+#endif // SIM_TIME_H
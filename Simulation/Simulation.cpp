@@ -0,0 +1,405 @@
+#include "Simulation.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include "../Arena/Tiles/Tile_Effects.h"
+
+namespace {
+    constexpr float INITIAL_LAUNCH_FORCE = 1500.0f;
+    constexpr float SPAWN_OFFSET_DISTANCE = 30.0f;
+    constexpr float PAINT_RADIUS = 3.0f;
+    // At least a player's reach plus a balloon's radius across, so a hit
+    // query covers at most 2 x 2 cells.
+    constexpr float COLLISION_CELL_SIZE = 64.0f;
+    constexpr float SPAWN_INSET_TILES = 2.0f;
+
+    // Kept clear of the tile effect colors.
+    const std::array<sf::Color, Simulation::MaxPlayers> PLAYER_COLORS = {
+        sf::Color::Blue, sf::Color::Cyan, sf::Color(255, 140, 0), sf::Color(255, 105, 180),
+        sf::Color(139, 69, 19), sf::Color(0, 128, 128), sf::Color(128, 128, 0), sf::Color(40, 40, 40)
+    };
+
+    // Opposite corners first, then the other two corners, then the middle
+    // of each edge, as fractions of the world size.
+    const std::array<sf::Vector2f, Simulation::MaxPlayers> SPAWN_ANCHORS = {{
+        {0.0f, 0.0f}, {1.0f, 1.0f}, {1.0f, 0.0f}, {0.0f, 1.0f},
+        {0.5f, 0.0f}, {0.5f, 1.0f}, {0.0f, 0.5f}, {1.0f, 0.5f}
+    }};
+
+    sf::Vector2f spawnPosition(int playerIndex, sf::Vector2f worldSize) {
+        float inset = Tile::getSize() * SPAWN_INSET_TILES;
+        sf::Vector2f anchor = SPAWN_ANCHORS[playerIndex];
+        return {inset + anchor.x * (worldSize.x - 2.0f * inset), inset + anchor.y * (worldSize.y - 2.0f * inset)};
+    }
+
+    // A timer payload is its kind in the top byte and the player or balloon
+    // index it is for in the low 32 bits.
+    enum class Timer_Kind : std::uint8_t { BalloonExpiry, DamageTick, PaintReady, LaunchReady };
+
+    std::uint64_t timerPayload(Timer_Kind kind, std::size_t index) {
+        return (static_cast<std::uint64_t>(kind) << 56) | static_cast<std::uint32_t>(index);
+    }
+    Timer_Kind timerKind(std::uint64_t payload) { return static_cast<Timer_Kind>(payload >> 56); }
+    std::uint32_t timerIndex(std::uint64_t payload) { return static_cast<std::uint32_t>(payload); }
+}
+
+const Tile_Odds Simulation::DefaultTileOdds = {0.005f, 0.02f, 0.02f, 0.005f, 0.002f};
+
+Simulation::Simulation(int gridSize, std::uint64_t seed, int playerCount, const Tile_Odds& odds, std::size_t balloonCapacity) :
+    grid(gridSize, gridSize, seed, odds),
+    balloons(balloonCapacity),
+    balloonHash(COLLISION_CELL_SIZE),
+    timers(balloonCapacity + 3 * static_cast<std::size_t>(std::max(playerCount, 0))),
+    coordDist(0, gridSize - 1) {
+    if (playerCount < MinPlayers || playerCount > MaxPlayers) {
+        throw std::invalid_argument("A match needs between " + std::to_string(MinPlayers) + " and " +
+                                    std::to_string(MaxPlayers) + " players, not " + std::to_string(playerCount));
+    }
+    std::seed_seq sequence{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+    rng.seed(sequence);
+    balloonHash.reserve(balloonCapacity);
+    balloonHit.reserve(balloonCapacity);
+    deadBalloons.reserve(balloonCapacity);
+
+    sf::Vector2f worldSize = getWorldSize();
+    players.reserve(playerCount);
+    damageTimers.resize(playerCount);
+    for (int i = 0; i < playerCount; ++i) {
+        players.emplace_back(i + 1, PLAYER_COLORS[i], spawnPosition(i, worldSize));
+    }
+    for (int i = 0; i < playerCount; ++i) {
+        timers.schedule(players[i].getPaintCooldownTicks(), 0, timerPayload(Timer_Kind::PaintReady, i));
+        timers.schedule(players[i].getLaunchCooldownTicks(), 0, timerPayload(Timer_Kind::LaunchReady, i));
+        damageTimers[i] = timers.schedule(players[i].getDamageTickInterval(), 0, timerPayload(Timer_Kind::DamageTick, i));
+    }
+}
+
+std::uint64_t Simulation::RandomSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) ^ device();
+}
+
+sf::Vector2f Simulation::getWorldSize() const {
+    return {static_cast<float>(grid.getWidth()) * Tile::getSize(), static_cast<float>(grid.getHeight()) * Tile::getSize()};
+}
+
+int Simulation::getTotalTiles() const {
+    return grid.getWidth() * grid.getHeight();
+}
+
+int Simulation::getOwnedTileCount(int playerID) const {
+    return grid.getOwnedCount(playerID);
+}
+
+void Simulation::takeTileChanges(std::vector<Tile_Change>& out) {
+    out.insert(out.end(), pendingTileChanges.begin(), pendingTileChanges.end());
+    pendingTileChanges.clear();
+}
+
+void Simulation::step(Inputs inputs) {
+    if (isFinished()) {
+        return;
+    }
+
+    timers.advance(tickCount, [this](std::uint64_t payload) { onTimer(payload); });
+    removeDeadBalloons();
+
+    const float dt = StepSeconds;
+    for (int i = 0; i < getPlayerCount(); ++i) {
+        if (players[i].isEliminatedPlayer()) {
+            continue;
+        }
+        Player_Input input = Input_Words::get(inputs, i);
+        if (input.has(Player_Action::Launch)) {
+            launchBalloon(i);
+        }
+        if (input.has(Player_Action::Paint)) {
+            paintNearbyTiles(i);
+        }
+    }
+
+    sf::Vector2f worldSize = getWorldSize();
+    for (int i = 0; i < getPlayerCount(); ++i) {
+        if (!players[i].isEliminatedPlayer()) {
+            players[i].updatePosition(Input_Words::get(inputs, i), dt, worldSize);
+        }
+    }
+    updateBalloons();
+    for (int i = 0; i < getPlayerCount(); ++i) {
+        if (!players[i].isEliminatedPlayer()) {
+            processPlayerTileInteraction(i);
+        }
+    }
+    resolveBalloonHits();
+
+    ++tickCount;
+    result = checkWinCondition();
+}
+
+// A balloon chases whichever opponent was closest when it was launched.
+int Simulation::findNearestOpponent(int playerIndex) const {
+    sf::Vector2f from = players[playerIndex].getPosition();
+    int nearest = -1;
+    float nearestDistance = std::numeric_limits<float>::max();
+    for (int i = 0; i < getPlayerCount(); ++i) {
+        if (i == playerIndex || players[i].isEliminatedPlayer()) {
+            continue;
+        }
+        sf::Vector2f offset = players[i].getPosition() - from;
+        float distance = offset.x * offset.x + offset.y * offset.y;
+        if (distance < nearestDistance) {
+            nearest = i;
+            nearestDistance = distance;
+        }
+    }
+    return nearest;
+}
+
+void Simulation::launchBalloon(int playerIndex) {
+    Player& player = players[playerIndex];
+    if (!player.canLaunch() || balloons.full()) {
+        return;
+    }
+    sf::Vector2f launchDirection = player.getLaunchDirection();
+    sf::Vector2f spawnPosition = player.getPosition() + (launchDirection * SPAWN_OFFSET_DISTANCE);
+    int target = findNearestOpponent(playerIndex);
+    Timer_Handle expiry = timers.schedule(tickCount + Balloon_Pool::getLifespanTicks(), 0,
+                                          timerPayload(Timer_Kind::BalloonExpiry, balloons.size()));
+    balloons.spawn(player.getColor(), spawnPosition, player.getPlayerID(), target, launchDirection * INITIAL_LAUNCH_FORCE, expiry);
+    player.setLaunchReady(false);
+    timers.schedule(tickCount + player.getLaunchCooldownTicks(), 0, timerPayload(Timer_Kind::LaunchReady, playerIndex));
+}
+
+const Disc_Mask& Simulation::getPaintMask(float radiusTiles) {
+    for (const Disc_Mask& mask : paintMasks) {
+        if (mask.getRadius() == radiusTiles) {
+            return mask;
+        }
+    }
+    return paintMasks.emplace_back(radiusTiles);
+}
+
+// The disc is centred on the tile under the player, so its footprint comes
+// straight from the mask for the player's paint radius. Painting used to
+// test each tile against the player's exact position; snapping the centre
+// to the tile moves the footprint by up to half a tile in each direction,
+// so seeded matches claim different tiles, and can end differently, than
+// they did with exact-position painting.
+void Simulation::paintNearbyTiles(int playerIndex) {
+    Player& player = players[playerIndex];
+    if (!player.canPaint()) {
+        return;
+    }
+
+    float tileSize = Tile::getSize();
+    sf::Vector2f playerCenter = player.getPosition();
+    const Disc_Mask& mask = getPaintMask(player.getPaintRadius(PAINT_RADIUS) / tileSize);
+    int centerX = std::clamp(static_cast<int>(playerCenter.x / tileSize), 0, grid.getWidth() - 1);
+    int centerY = std::clamp(static_cast<int>(playerCenter.y / tileSize), 0, grid.getHeight() - 1);
+
+    paintSpans.clear();
+    for (const Disc_Mask::Span& span : mask.getSpans()) {
+        int y = centerY + span.dy;
+        if (y < 0 || y >= grid.getHeight()) {
+            continue;
+        }
+        int minX = std::max(0, centerX + span.minDx);
+        int maxX = std::min(grid.getWidth() - 1, centerX + span.maxDx);
+        if (minX <= maxX) {
+            paintSpans.push_back({y, minX, maxX});
+        }
+    }
+    grid.claimSpans(paintSpans, player.getPlayerID(), player.getColor(), pendingTileChanges);
+    player.setPaintReady(false);
+    timers.schedule(tickCount + player.getPaintCooldownTicks(), 0,
+                    timerPayload(Timer_Kind::PaintReady, playerIndex));
+}
+
+void Simulation::processPlayerTileInteraction(int playerIndex) {
+    Player& player = players[playerIndex];
+    sf::FloatRect playerBounds = player.getBounds();
+    float tileSize = Tile::getSize();
+
+    int minTileX = static_cast<int>(playerBounds.position.x / tileSize);
+    int maxTileX = static_cast<int>((playerBounds.position.x + playerBounds.size.x) / tileSize);
+    int minTileY = static_cast<int>(playerBounds.position.y / tileSize);
+    int maxTileY = static_cast<int>((playerBounds.position.y + playerBounds.size.y) / tileSize);
+
+    minTileX = std::max(0, minTileX);
+    maxTileX = std::min(grid.getWidth() - 1, maxTileX);
+    minTileY = std::max(0, minTileY);
+    maxTileY = std::min(grid.getHeight() - 1, maxTileY);
+
+    player.setStuck(false,1);
+    player.setOnDamageTile(false);
+
+    bool onSpecialTile = false;
+
+    for (int y = minTileY; y <= maxTileY; ++y) {
+        for (int x = minTileX; x <= maxTileX; ++x) {
+            sf::FloatRect tileBounds = grid.getTileBounds(x, y);
+            bool manual_intersects =
+                playerBounds.position.x < tileBounds.position.x + tileBounds.size.x &&
+                playerBounds.position.x + playerBounds.size.x > tileBounds.position.x &&
+                playerBounds.position.y < tileBounds.position.y + tileBounds.size.y &&
+                playerBounds.position.y + playerBounds.size.y > tileBounds.position.y;
+
+            if (manual_intersects) {
+                std::size_t tileIndex = grid.index(x, y);
+                sf::Vector2i currentTileIdx = {x, y};
+                bool enteredThisTile = (player.getLastGridPosition() != currentTileIdx);
+
+                TileSpecialType type = grid.getType(tileIndex);
+                if (type != TileSpecialType::NONE) {
+                    const Tile_Effect& effect = Tile_Effects::get(type);
+                    onSpecialTile = true;
+                    if (effect.slows()) {
+                        player.setStuck(true, effect.slowFactor);
+                    }
+                    if (effect.damages()) {
+                        player.setOnDamageTile(true);
+                        if (enteredThisTile) {
+                            player.takeTileDamage(effect.entryDamage);
+                            restartDamageTick(playerIndex);
+                        } else if (player.isDamageTickDue()) {
+                            player.takeTileDamage(effect.tickDamage);
+                            restartDamageTick(playerIndex);
+                        }
+                    }
+                    if (effect.entryHeal > 0 && enteredThisTile &&
+                        (!effect.healOwnerOnly || grid.getOwner(tileIndex) == player.getPlayerID())) {
+                        player.heal(static_cast<float>(effect.entryHeal));
+                    }
+                    if (effect.teleports && enteredThisTile) {
+                        int newX = coordDist(rng);
+                        int newY = coordDist(rng);
+                        sf::Vector2f newPos = {static_cast<float>(newX * tileSize + tileSize / 2.0f),
+                                               static_cast<float>(newY * tileSize + tileSize / 2.0f)};
+                        player.setPosition(newPos);
+                        player.setLastGridPosition({-1,-1});
+                    } else {
+                        player.setLastGridPosition(currentTileIdx);
+                    }
+                    break;
+                }
+            }
+        }
+        if (onSpecialTile) {
+            break;
+        }
+    }
+}
+
+// The damage timer only marks the tick as due; the damage itself is dealt
+// by the tile interaction, after the player has moved, on the first step
+// the player stands on a damage tile once it is due.
+void Simulation::restartDamageTick(int playerIndex) {
+    Player& player = players[playerIndex];
+    player.setDamageTickDue(false);
+    timers.cancel(damageTimers[playerIndex]);
+    damageTimers[playerIndex] = timers.schedule(tickCount + player.getDamageTickInterval(), 0,
+                                                timerPayload(Timer_Kind::DamageTick, playerIndex));
+}
+
+void Simulation::updateBalloons() {
+    balloons.update(players);
+}
+
+// Any balloon can hit any player but its owner. Balloons are hashed once per
+// step and each player only tests the ones in the cells around it.
+void Simulation::resolveBalloonHits() {
+    balloonHash.build(balloons.size(), [this](std::size_t i) { return balloons.getPosition(i); });
+    balloonHit.assign(balloons.size(), 0);
+
+    float balloonRadius = Balloon_Pool::getRadius();
+    for (Player& player : players) {
+        if (player.isEliminatedPlayer()) {
+            continue;
+        }
+        float reach = player.getRadius() + balloonRadius;
+        sf::Vector2f center = player.getPosition();
+        sf::FloatRect area({center.x - reach, center.y - reach}, {2.0f * reach, 2.0f * reach});
+        balloonHash.query(area, [&](std::uint32_t i) {
+            if (balloonHit[i] || player.isEliminatedPlayer() || balloons.getOwnerID(i) == player.getPlayerID()) {
+                return;
+            }
+            sf::Vector2f dist = balloons.getPosition(i) - center;
+            if ((dist.x * dist.x + dist.y * dist.y) < reach * reach) {
+                player.getDamageBalloon();
+                balloonHit[i] = 1;
+            }
+        });
+    }
+
+    for (std::size_t i = 0; i < balloonHit.size(); ++i) {
+        if (balloonHit[i]) {
+            deadBalloons.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+    removeDeadBalloons();
+}
+
+void Simulation::onTimer(std::uint64_t payload) {
+    std::uint32_t index = timerIndex(payload);
+    switch (timerKind(payload)) {
+        case Timer_Kind::BalloonExpiry:
+            deadBalloons.push_back(index);
+            break;
+        case Timer_Kind::DamageTick:
+            players[index].setDamageTickDue(true);
+            break;
+        case Timer_Kind::PaintReady:
+            players[index].setPaintReady(true);
+            break;
+        case Timer_Kind::LaunchReady:
+            players[index].setLaunchReady(true);
+            break;
+    }
+}
+
+// Back to front, so a balloon swapped into a freed slot is never one still
+// waiting to be removed. Each move retargets the moved balloon's timer.
+void Simulation::removeDeadBalloons() {
+    std::sort(deadBalloons.begin(), deadBalloons.end(), std::greater<std::uint32_t>());
+    deadBalloons.erase(std::unique(deadBalloons.begin(), deadBalloons.end()), deadBalloons.end());
+    for (std::uint32_t i : deadBalloons) {
+        timers.cancel(balloons.getExpiryTimer(i));
+        if (balloons.remove(i)) {
+            timers.setPayload(balloons.getExpiryTimer(i), timerPayload(Timer_Kind::BalloonExpiry, i));
+        }
+    }
+    deadBalloons.clear();
+}
+
+// A player wins by owning a majority of the tiles or by being the last one
+// standing. If the last players are eliminated in the same step, it is a draw.
+int Simulation::checkWinCondition() const {
+    int totalPlayableTiles = getTotalTiles();
+    if (totalPlayableTiles > 0) {
+        int winTileThreshold = (totalPlayableTiles / 2) + 1;
+        for (const Player& player : players) {
+            if (getOwnedTileCount(player.getPlayerID()) >= winTileThreshold) {
+                return player.getPlayerID();
+            }
+        }
+    }
+
+    int survivors = 0;
+    int lastSurvivor = 0;
+    for (const Player& player : players) {
+        if (player.getHealth() > 0) {
+            ++survivors;
+            lastSurvivor = player.getPlayerID();
+        }
+    }
+    if (survivors == 1) {
+        return lastSurvivor;
+    }
+    if (survivors == 0) {
+        return 0;
+    }
+    return -1;
+}
@@ -0,0 +1,91 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../Arena/Tile_Grid.h"
+#include "../Player.h"
+#include "../Balloon.h"
+#include "Disc_Mask.h"
+#include "Player_Input.h"
+#include "Spatial_Hash.h"
+#include "Sim_Time.h"
+#include "Timer_Wheel.h"
+
+// One match: the tile grid, the players and the balloons, advanced only by
+// step(), one Sim_Time tick at a time. Nothing here opens a window, loads a
+// resource or reads a clock, so the same seed and the same inputs always
+// play out the same way, at any frame rate or with no window at all.
+// Cooldowns, damage ticks and balloon lifetimes are timers on one wheel.
+class Simulation {
+public:
+    static constexpr int MinPlayers = 2;
+    // One Input_Word per step holds a byte per player.
+    static constexpr int MaxPlayers = Input_Words::MaxPlayers;
+    static constexpr int DefaultPlayerCount = 2;
+    static constexpr float StepSeconds = Sim_Time::StepSeconds;
+    using Inputs = Input_Word;
+
+    static const Tile_Odds DefaultTileOdds;
+
+    Simulation(int gridSize, std::uint64_t seed, int playerCount = DefaultPlayerCount,
+               const Tile_Odds& odds = DefaultTileOdds, std::size_t balloonCapacity = Balloon_Pool::DefaultCapacity);
+    Simulation(const Simulation&) = delete;
+    Simulation& operator=(const Simulation&) = delete;
+
+    void step(Inputs inputs);
+
+    const Tile_Grid& getGrid() const { return grid; }
+    const std::vector<Player>& getPlayers() const { return players; }
+    int getPlayerCount() const { return static_cast<int>(players.size()); }
+    const Balloon_Pool& getBalloons() const { return balloons; }
+    sf::Vector2f getWorldSize() const;
+    int getTotalTiles() const;
+    int getOwnedTileCount(int playerID) const;
+    Sim_Time::Tick getTickCount() const { return tickCount; }
+    float getElapsedTime() const { return Sim_Time::seconds(tickCount); }
+
+    // -1 while the match runs, 0 for a draw, otherwise the winner's number.
+    int getResult() const { return result; }
+    bool isFinished() const { return result != -1; }
+
+    // Moves the ownership changes since the last call into out.
+    void takeTileChanges(std::vector<Tile_Change>& out);
+
+    static std::uint64_t RandomSeed();
+
+private:
+    Tile_Grid grid;
+    std::vector<Player> players;
+    Balloon_Pool balloons;
+    std::vector<Tile_Change> pendingTileChanges;
+    Spatial_Hash balloonHash;
+    std::vector<std::uint8_t> balloonHit;
+    std::vector<std::uint32_t> deadBalloons;
+    Timer_Wheel timers;
+    std::vector<Timer_Handle> damageTimers;
+    std::vector<Disc_Mask> paintMasks;
+    // The clipped rows of the stroke being painted, kept to reuse its memory.
+    std::vector<Tile_Span> paintSpans;
+    std::mt19937 rng;
+    std::uniform_int_distribution<int> coordDist;
+    Sim_Time::Tick tickCount = 0;
+    int result = -1;
+
+    int findNearestOpponent(int playerIndex) const;
+    void launchBalloon(int playerIndex);
+    void paintNearbyTiles(int playerIndex);
+    const Disc_Mask& getPaintMask(float radiusTiles);
+    void processPlayerTileInteraction(int playerIndex);
+    void restartDamageTick(int playerIndex);
+    void updateBalloons();
+    void resolveBalloonHits();
+    void onTimer(std::uint64_t payload);
+    void removeDeadBalloons();
+    int checkWinCondition() const;
+};
+
+#endif // SIMULATION_H
@@ -0,0 +1,96 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Broadphase over world coordinates: entries are bucketed by the uniform
+// grid cell their position falls in, with cells hashed into a power-of-two
+// bucket table. build() is a counting sort, so rebuilding every step costs
+// O(n) and, once the tables have grown, allocates nothing.
+//
+// Two cells can share a bucket, so a query may report an entry that is not
+// near the area, or the same entry twice; callers do the exact test.
+class Spatial_Hash {
+    float cellSize;
+    std::size_t bucketMask = 0;
+    std::vector<std::uint32_t> bucketStart;
+    std::vector<std::uint32_t> entries;
+    std::vector<std::uint32_t> entryBucket;
+
+    int cellCoordinate(float value) const {
+        return static_cast<int>(std::floor(value / cellSize));
+    }
+
+    std::size_t bucketOf(int cellX, int cellY) const {
+        std::uint32_t hash = (static_cast<std::uint32_t>(cellX) * 73856093u) ^ (static_cast<std::uint32_t>(cellY) * 19349663u);
+        return hash & bucketMask;
+    }
+
+public:
+    explicit Spatial_Hash(float cellSize) : cellSize(cellSize) {}
+
+    // Sizes the tables for up to count entries so build() never allocates.
+    void reserve(std::size_t count) {
+        std::size_t bucketCount = 16;
+        while (bucketCount < count * 2) {
+            bucketCount *= 2;
+        }
+        bucketStart.reserve(bucketCount + 1);
+        entries.reserve(count);
+        entryBucket.reserve(count);
+    }
+
+    // positionOf(i) gives the position of entry i, for i in [0, count).
+    template <typename PositionOf>
+    void build(std::size_t count, PositionOf positionOf) {
+        std::size_t bucketCount = 16;
+        while (bucketCount < count * 2) {
+            bucketCount *= 2;
+        }
+        bucketMask = bucketCount - 1;
+        bucketStart.assign(bucketCount + 1, 0);
+        entries.resize(count);
+        entryBucket.resize(count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            sf::Vector2f position = positionOf(i);
+            std::size_t bucket = bucketOf(cellCoordinate(position.x), cellCoordinate(position.y));
+            entryBucket[i] = static_cast<std::uint32_t>(bucket);
+            ++bucketStart[bucket];
+        }
+        for (std::size_t bucket = 1; bucket <= bucketCount; ++bucket) {
+            bucketStart[bucket] += bucketStart[bucket - 1];
+        }
+        // Each bucket now holds its end; filling back to front walks it down
+        // to its start and leaves the entries of a bucket in index order.
+        for (std::size_t i = count; i-- > 0;) {
+            entries[--bucketStart[entryBucket[i]]] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    // Calls visit(i) for every entry whose cell overlaps area.
+    template <typename Visit>
+    void query(const sf::FloatRect& area, Visit visit) const {
+        if (entries.empty()) {
+            return;
+        }
+        int minCellX = cellCoordinate(area.position.x);
+        int maxCellX = cellCoordinate(area.position.x + area.size.x);
+        int minCellY = cellCoordinate(area.position.y);
+        int maxCellY = cellCoordinate(area.position.y + area.size.y);
+        for (int cellY = minCellY; cellY <= maxCellY; ++cellY) {
+            for (int cellX = minCellX; cellX <= maxCellX; ++cellX) {
+                std::size_t bucket = bucketOf(cellX, cellY);
+                for (std::uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; ++i) {
+                    visit(entries[i]);
+                }
+            }
+        }
+    }
+};
+
+#endif // SPATIAL_HASH_H
@@ -0,0 +1,118 @@
+#include "Timer_Wheel.h"
+
+Timer_Wheel::Timer_Wheel(std::size_t capacity) {
+    slotHeads.fill(Timer_Handle::None);
+    timers.reserve(capacity);
+    freeTimers.reserve(capacity);
+    firing.reserve(capacity);
+}
+
+void Timer_Wheel::link(std::uint32_t index) {
+    Timer& timer = timers[index];
+    Sim_Time::Tick delta = timer.due - currentTick;
+    int level = 0;
+    while (level < Levels - 1 && delta >= (Sim_Time::Tick(1) << (LevelBits * (level + 1)))) {
+        ++level;
+    }
+    // Beyond the top level: park in the farthest slot and re-file on cascade.
+    Sim_Time::Tick filedAt = timer.due;
+    Sim_Time::Tick reach = Sim_Time::Tick(1) << (LevelBits * Levels);
+    if (delta >= reach) {
+        filedAt = currentTick + reach - 1;
+    }
+    std::uint32_t slot = static_cast<std::uint32_t>((filedAt >> (LevelBits * level)) & (SlotsPerLevel - 1));
+    timer.slot = static_cast<std::uint32_t>(level) * SlotsPerLevel + slot;
+    timer.prev = Timer_Handle::None;
+    timer.next = slotHeads[timer.slot];
+    if (timer.next != Timer_Handle::None) {
+        timers[timer.next].prev = index;
+    }
+    slotHeads[timer.slot] = index;
+}
+
+void Timer_Wheel::unlink(std::uint32_t index) {
+    Timer& timer = timers[index];
+    if (timer.slot == NoSlot) {
+        return;
+    }
+    if (timer.prev != Timer_Handle::None) {
+        timers[timer.prev].next = timer.next;
+    } else {
+        slotHeads[timer.slot] = timer.next;
+    }
+    if (timer.next != Timer_Handle::None) {
+        timers[timer.next].prev = timer.prev;
+    }
+    timer.prev = Timer_Handle::None;
+    timer.next = Timer_Handle::None;
+    timer.slot = NoSlot;
+}
+
+void Timer_Wheel::release(std::uint32_t index) {
+    Timer& timer = timers[index];
+    timer.active = false;
+    ++timer.generation;
+    freeTimers.push_back(index);
+    --activeCount;
+}
+
+void Timer_Wheel::takeSlot(std::uint32_t slot) {
+    std::uint32_t index = slotHeads[slot];
+    slotHeads[slot] = Timer_Handle::None;
+    while (index != Timer_Handle::None) {
+        Timer& timer = timers[index];
+        std::uint32_t next = timer.next;
+        timer.prev = Timer_Handle::None;
+        timer.next = Timer_Handle::None;
+        timer.slot = NoSlot;
+        firing.push_back(index);
+        index = next;
+    }
+}
+
+void Timer_Wheel::cascade(int level, std::uint32_t slot) {
+    std::size_t start = firing.size();
+    takeSlot(static_cast<std::uint32_t>(level) * SlotsPerLevel + slot);
+    for (std::size_t i = start; i < firing.size(); ++i) {
+        link(firing[i]);
+    }
+    firing.resize(start);
+}
+
+Timer_Handle Timer_Wheel::schedule(Sim_Time::Tick due, Sim_Time::Tick period, std::uint64_t payload) {
+    std::uint32_t index;
+    if (!freeTimers.empty()) {
+        index = freeTimers.back();
+        freeTimers.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(timers.size());
+        timers.emplace_back();
+    }
+    Timer& timer = timers[index];
+    timer.due = due > currentTick ? due : currentTick + 1;
+    timer.period = period;
+    timer.payload = payload;
+    timer.active = true;
+    ++activeCount;
+    link(index);
+    return {index, timer.generation};
+}
+
+bool Timer_Wheel::isActive(Timer_Handle handle) const {
+    return handle.index < timers.size() && timers[handle.index].active && timers[handle.index].generation == handle.generation;
+}
+
+bool Timer_Wheel::cancel(Timer_Handle handle) {
+    if (!isActive(handle)) {
+        return false;
+    }
+    unlink(handle.index);
+    release(handle.index);
+    return true;
+}
+
+void Timer_Wheel::setPayload(Timer_Handle handle, std::uint64_t payload) {
+    if (isActive(handle)) {
+        timers[handle.index].payload = payload;
+    }
+}
@@ -0,0 +1,119 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "Sim_Time.h"
+
+// Refers to one scheduled timer. The generation makes a handle go stale
+// once its timer has fired (one-shot) or been cancelled, even if the slot
+// has been reused since.
+struct Timer_Handle {
+    static constexpr std::uint32_t None = std::numeric_limits<std::uint32_t>::max();
+    std::uint32_t index = None;
+    std::uint32_t generation = 0;
+};
+
+// Hierarchical timing wheel over simulation ticks: four levels of 256 slots,
+// level k holding timers due within 256^(k+1) ticks. A timer sits in one
+// intrusive list, so schedule and cancel are O(1); advancing a tick touches
+// only the slot that comes due, plus, every 256 ticks, the one slot of the
+// next level that cascades down. Timers carry a 64-bit payload instead of a
+// closure, and are kept in a reusable pool, so nothing allocates once the
+// pool has grown to the peak number of live timers.
+class Timer_Wheel {
+    static constexpr int LevelBits = 8;
+    static constexpr std::uint32_t SlotsPerLevel = 1u << LevelBits;
+    static constexpr int Levels = 4;
+    static constexpr std::uint32_t NoSlot = std::numeric_limits<std::uint32_t>::max();
+
+    struct Timer {
+        Sim_Time::Tick due = 0;
+        Sim_Time::Tick period = 0;
+        std::uint64_t payload = 0;
+        std::uint32_t prev = Timer_Handle::None;
+        std::uint32_t next = Timer_Handle::None;
+        std::uint32_t generation = 0;
+        // Level * SlotsPerLevel + slot while in the wheel, NoSlot otherwise.
+        std::uint32_t slot = NoSlot;
+        bool active = false;
+    };
+
+    std::vector<Timer> timers;
+    std::vector<std::uint32_t> freeTimers;
+    std::array<std::uint32_t, Levels * SlotsPerLevel> slotHeads;
+    std::vector<std::uint32_t> firing;
+    Sim_Time::Tick currentTick = 0;
+    std::size_t activeCount = 0;
+
+    void link(std::uint32_t index);
+    void unlink(std::uint32_t index);
+    void release(std::uint32_t index);
+    void cascade(int level, std::uint32_t slot);
+    // Moves the timers of one slot into firing, leaving the slot empty.
+    void takeSlot(std::uint32_t slot);
+
+public:
+    explicit Timer_Wheel(std::size_t capacity = 0);
+
+    // Runs once at tick due, and then every period ticks if period is not 0.
+    // A due tick that has already been advanced past fires on the next tick.
+    Timer_Handle schedule(Sim_Time::Tick due, Sim_Time::Tick period, std::uint64_t payload);
+    // Returns false if the handle had already fired or been cancelled.
+    bool cancel(Timer_Handle handle);
+    bool isActive(Timer_Handle handle) const;
+    void setPayload(Timer_Handle handle, std::uint64_t payload);
+
+    // Fires everything due up to and including now, in due order, calling
+    // fire(payload) for each. fire may schedule and cancel timers.
+    template <typename Fire>
+    void advance(Sim_Time::Tick now, Fire fire);
+
+    Sim_Time::Tick getCurrentTick() const { return currentTick; }
+    std::size_t size() const { return activeCount; }
+};
+
+template <typename Fire>
+void Timer_Wheel::advance(Sim_Time::Tick now, Fire fire) {
+    while (currentTick < now) {
+        ++currentTick;
+        std::uint32_t slot0 = static_cast<std::uint32_t>(currentTick & (SlotsPerLevel - 1));
+        if (slot0 == 0) {
+            for (int level = 1; level < Levels; ++level) {
+                std::uint32_t slot = static_cast<std::uint32_t>((currentTick >> (LevelBits * level)) & (SlotsPerLevel - 1));
+                cascade(level, slot);
+                if (slot != 0) {
+                    break;
+                }
+            }
+        }
+
+        firing.clear();
+        takeSlot(slot0);
+        for (std::uint32_t index : firing) {
+            Timer& timer = timers[index];
+            // Cancelled by an earlier callback, and maybe already reused.
+            if (!timer.active || timer.slot != NoSlot) {
+                continue;
+            }
+            // Parked further out than the wheel reaches; not due yet.
+            if (timer.due > currentTick) {
+                link(index);
+                continue;
+            }
+            std::uint64_t payload = timer.payload;
+            if (timer.period > 0) {
+                timer.due += timer.period;
+                link(index);
+            } else {
+                release(index);
+            }
+            fire(payload);
+        }
+    }
+}
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,98 @@
+#include <cstring>
+#include <random>
+#include <vector>
+#include "../Simulation/Balloon_Kernel.h"
+#include "../Simulation/Sim_Time.h"
+#include "Test_Check.h"
+
+namespace {
+    constexpr int PLAYERS = 4;
+    constexpr int STEPS = 90;
+
+    struct Lanes {
+        std::vector<float> positionX, positionY, velocityX, velocityY, launchX, launchY;
+        std::vector<std::int32_t> ageTicks;
+        std::vector<int> targetIndex;
+
+        Balloon_Lanes view() {
+            return {positionX.data(), positionY.data(), velocityX.data(), velocityY.data(),
+                    launchX.data(), launchY.data(), ageTicks.data(), targetIndex.data(), ageTicks.size()};
+        }
+    };
+
+    bool sameBits(const std::vector<float>& a, const std::vector<float>& b) {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+    }
+
+    // Targets before the first player, past the last one, on an eliminated
+    // one and none at all; balloons sitting exactly on their target;
+    // launches from standstill to past the speed clamp, and ages on both
+    // sides of the launch boost.
+    Lanes randomLanes(std::uint32_t seed, std::size_t count, const std::vector<float>& playerX, const std::vector<float>& playerY) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coordinate(0.0f, 2000.0f);
+        std::uniform_real_distribution<float> launch(-2000.0f, 2000.0f);
+        std::uniform_int_distribution<std::int32_t> age(0, Sim_Time::TicksPerSecond);
+        std::uniform_int_distribution<int> target(-2, PLAYERS + 1);
+
+        Lanes lanes;
+        for (std::size_t i = 0; i < count; ++i) {
+            int targetIndex = target(rng);
+            bool onTarget = targetIndex >= 0 && targetIndex < PLAYERS && i % 13 == 0;
+            lanes.positionX.push_back(onTarget ? playerX[targetIndex + 1] : coordinate(rng));
+            lanes.positionY.push_back(onTarget ? playerY[targetIndex + 1] : coordinate(rng));
+            float speedScale = i % 5 == 0 ? 0.0001f : 1.0f;
+            lanes.launchX.push_back(i % 17 == 0 ? 0.0f : launch(rng) * speedScale);
+            lanes.launchY.push_back(i % 17 == 0 ? 0.0f : launch(rng) * speedScale);
+            lanes.ageTicks.push_back(age(rng));
+            lanes.targetIndex.push_back(targetIndex);
+        }
+        lanes.velocityX.assign(count, 0.0f);
+        lanes.velocityY.assign(count, 0.0f);
+        return lanes;
+    }
+
+    void checkPathMatchesScalar(Balloon_Kernel::Path path, std::uint32_t seed, std::size_t count) {
+        // Slot 0 is "no target"; the last player is eliminated.
+        std::vector<float> playerX = {0.0f, 100.0f, 1900.0f, 1000.0f, 500.0f};
+        std::vector<float> playerY = {0.0f, 100.0f, 1900.0f, 1000.0f, 1500.0f};
+        std::vector<float> tracking = {0.0f, 1.0f, 1.0f, 1.0f, 0.0f};
+        Balloon_Motion motion = {250.0f, 700.0f, 0.5f};
+
+        Lanes reference = randomLanes(seed, count, playerX, playerY);
+        Lanes lanes = reference;
+        bool identical = true;
+        for (int step = 0; step < STEPS && identical; ++step) {
+            for (std::size_t slot = 1; slot < playerX.size(); ++slot) {
+                playerX[slot] += static_cast<float>(slot);
+                playerY[slot] -= 0.5f * static_cast<float>(slot);
+            }
+            Balloon_Targets targets = {playerX.data(), playerY.data(), tracking.data(), PLAYERS};
+            Balloon_Kernel::update(reference.view(), targets, motion, Sim_Time::StepSeconds, Balloon_Kernel::Path::Scalar);
+            Balloon_Kernel::update(lanes.view(), targets, motion, Sim_Time::StepSeconds, path);
+            identical = sameBits(lanes.positionX, reference.positionX) && sameBits(lanes.positionY, reference.positionY) &&
+                        sameBits(lanes.velocityX, reference.velocityX) && sameBits(lanes.velocityY, reference.velocityY) &&
+                        lanes.ageTicks == reference.ageTicks;
+        }
+        if (!identical) {
+            std::cerr << Balloon_Kernel::getName(path) << " differs from scalar with " << count << " balloons" << std::endl;
+        }
+        CHECK(identical);
+    }
+}
+
+int main() {
+    CHECK(Balloon_Kernel::isSupported(Balloon_Kernel::Path::Scalar));
+    CHECK(Balloon_Kernel::isSupported(Balloon_Kernel::bestPath()));
+    for (Balloon_Kernel::Path path : {Balloon_Kernel::Path::SSE2, Balloon_Kernel::Path::AVX2}) {
+        if (!Balloon_Kernel::isSupported(path)) {
+            std::cout << Balloon_Kernel::getName(path) << ": not supported here, skipped" << std::endl;
+            continue;
+        }
+        // Counts around the vector widths exercise the scalar tails.
+        for (std::size_t count : {0, 1, 3, 4, 5, 7, 8, 9, 15, 17, 1003, 20000}) {
+            checkPathMatchesScalar(path, static_cast<std::uint32_t>(count + 1), count);
+        }
+    }
+    return Test_Check::result("Balloon_Kernel_Test");
+}
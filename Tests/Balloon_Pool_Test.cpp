@@ -0,0 +1,121 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include "../Balloon.h"
+#include "../Player.h"
+#include "Test_Check.h"
+
+// Counts every allocation in the process so the test can show that a
+// reserved pool spawns and updates without touching the heap.
+namespace {
+    std::atomic<long> allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+    // Balloon n carries n in every field, so a slot whose fields disagree
+    // means the arrays came out of step.
+    void spawnNumbered(Balloon_Pool& pool, int n) {
+        sf::Color color(static_cast<std::uint8_t>(n), static_cast<std::uint8_t>(n >> 8), static_cast<std::uint8_t>(n >> 16));
+        float value = static_cast<float>(n);
+        pool.spawn(color, {value, -value}, n, n % 3, {value * 2.0f, value * 3.0f},
+                   Timer_Handle{static_cast<std::uint32_t>(n), static_cast<std::uint32_t>(n + 1)});
+    }
+
+    bool slotIsConsistent(const Balloon_Pool& pool, std::size_t i) {
+        int n = pool.getOwnerID(i);
+        sf::Color color = pool.getColor(i);
+        Timer_Handle expiry = pool.getExpiryTimer(i);
+        float value = static_cast<float>(n);
+        return pool.getPosition(i) == sf::Vector2f(value, -value) && pool.getTarget(i) == n % 3 &&
+               color.r == static_cast<std::uint8_t>(n) && color.g == static_cast<std::uint8_t>(n >> 8) &&
+               color.b == static_cast<std::uint8_t>(n >> 16) && expiry.index == static_cast<std::uint32_t>(n) &&
+               expiry.generation == static_cast<std::uint32_t>(n + 1);
+    }
+
+    void checkSwapRemove() {
+        Balloon_Pool pool(64);
+        std::vector<int> expected;
+        for (int n = 0; n < 64; ++n) {
+            spawnNumbered(pool, n);
+            expected.push_back(n);
+        }
+        CHECK(pool.full());
+
+        // Remove from the middle, the front and the back; remove() must
+        // report a move exactly when the slot was not the last one, and the
+        // slot must then hold what used to be last.
+        std::size_t order[] = {10, 0, 61, 30, 30, 5, 57, 1};
+        for (std::size_t i : order) {
+            bool wasLast = i == pool.size() - 1;
+            bool moved = pool.remove(i);
+            CHECK(moved != wasLast);
+            expected[i] = expected.back();
+            expected.pop_back();
+            CHECK(pool.size() == expected.size());
+            for (std::size_t slot = 0; slot < pool.size(); ++slot) {
+                CHECK(slotIsConsistent(pool, slot));
+                CHECK(pool.getOwnerID(slot) == expected[slot]);
+            }
+        }
+
+        while (!pool.empty()) {
+            pool.remove(0);
+        }
+        CHECK(pool.size() == 0);
+    }
+
+    void checkNoAllocationAfterReserve() {
+        constexpr int count = 100000;
+        Balloon_Pool pool;
+        CHECK(pool.capacity() >= count);
+        std::vector<Player> players;
+        players.emplace_back(1, sf::Color::Red, sf::Vector2f(100.0f, 100.0f));
+        players.emplace_back(2, sf::Color::Blue, sf::Vector2f(900.0f, 700.0f));
+        // The first update sizes the per-player target arrays.
+        pool.update(players);
+
+        long before = allocationCount;
+        for (int n = 0; n < count; ++n) {
+            spawnNumbered(pool, n);
+        }
+        pool.update(players);
+        for (int n = 0; n < count / 2; ++n) {
+            pool.remove(static_cast<std::size_t>(n) * 7 % pool.size());
+        }
+        pool.update(players);
+        CHECK(allocationCount == before);
+        CHECK(pool.size() == count - count / 2);
+    }
+
+    void checkFullPoolRefusesSpawn() {
+        Balloon_Pool pool(2);
+        spawnNumbered(pool, 1);
+        spawnNumbered(pool, 2);
+        CHECK(!pool.spawn(sf::Color::Red, {}, 3, -1, {}, Timer_Handle{}));
+        CHECK(pool.size() == 2);
+    }
+}
+
+int main() {
+    checkSwapRemove();
+    checkNoAllocationAfterReserve();
+    checkFullPoolRefusesSpawn();
+    return Test_Check::result("Balloon_Pool_Test");
+}
@@ -0,0 +1,79 @@
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../Game_Settings.h"
+#include "Test_Check.h"
+
+namespace {
+    // Runs fromArguments on a command line, program name included.
+    template <typename Settings>
+    bool parses(std::initializer_list<const char*> arguments, Settings* settings = nullptr) {
+        std::vector<std::string> storage = {"program"};
+        storage.insert(storage.end(), arguments.begin(), arguments.end());
+        std::vector<char*> argv;
+        for (std::string& argument : storage) {
+            argv.push_back(argument.data());
+        }
+        try {
+            Settings parsed = Settings::fromArguments(static_cast<int>(argv.size()), argv.data());
+            if (settings) {
+                *settings = parsed;
+            }
+            return true;
+        } catch (const std::invalid_argument&) {
+            return false;
+        }
+    }
+
+    void checkHeadlessValues() {
+        Headless_Settings settings;
+        CHECK(parses<Headless_Settings>({"--matches=5", "--seed=42", "--threads=3", "--grid=64"}, &settings));
+        CHECK(settings.matches == 5);
+        CHECK(settings.seed == 42 && settings.fixedSeed);
+        CHECK(settings.threads == 3);
+        CHECK(settings.gridSize == 64);
+
+        // Every number must be the whole value, not just its leading digits.
+        CHECK(!parses<Headless_Settings>({"--matches=5abc"}));
+        CHECK(!parses<Headless_Settings>({"--seed=12x"}));
+        CHECK(!parses<Headless_Settings>({"--threads=4.5"}));
+        CHECK(!parses<Headless_Settings>({"--grid=100 "}));
+        CHECK(!parses<Headless_Settings>({"--max-ticks=1e6"}));
+        CHECK(!parses<Headless_Settings>({"--curve-step=abc"}));
+
+        CHECK(!parses<Headless_Settings>({"--matches=0"}));
+        CHECK(!parses<Headless_Settings>({"--matches=-3"}));
+        CHECK(!parses<Headless_Settings>({"--seed=-1"}));
+        CHECK(!parses<Headless_Settings>({"--seed=99999999999999999999999"}));
+        CHECK(!parses<Headless_Settings>({"--players=1"}));
+        CHECK(!parses<Headless_Settings>({"--players=9"}));
+        CHECK(!parses<Headless_Settings>({"--bogus"}));
+        CHECK(!parses<Headless_Settings>({"--matches"}));
+    }
+
+    void checkGameValues() {
+        Game_Settings settings;
+        CHECK(parses<Game_Settings>({"--fps=144", "--time-scale=2.5", "--players=4"}, &settings));
+        CHECK(settings.pacing == Frame_Pacing::FixedRate && settings.targetFps == 144);
+        CHECK(settings.timeScale == 2.5f);
+        CHECK(settings.players == 4);
+
+        CHECK(!parses<Game_Settings>({"--fps=60fps"}));
+        CHECK(!parses<Game_Settings>({"--time-scale=2x"}));
+        CHECK(!parses<Game_Settings>({"--time-scale=0"}));
+        CHECK(!parses<Game_Settings>({"--time-scale=101"}));
+        CHECK(!parses<Game_Settings>({"--players=5"}));
+        CHECK(!parses<Game_Settings>({"--grid=20001"}));
+        // Too small for the players to fit inside the world.
+        CHECK(!parses<Game_Settings>({"--grid=1"}));
+        CHECK(!parses<Headless_Settings>({"--grid=7"}));
+        CHECK(parses<Headless_Settings>({"--grid=8"}));
+    }
+}
+
+int main() {
+    checkHeadlessValues();
+    checkGameValues();
+    return Test_Check::result("Game_Settings_Test");
+}
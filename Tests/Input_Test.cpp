@@ -0,0 +1,132 @@
+#include <stdexcept>
+#include "../Key_Bindings.h"
+#include "../Simulation/Player_Input.h"
+#include "Test_Check.h"
+
+namespace {
+    using Key = sf::Keyboard::Key;
+
+    constexpr Player_Action ALL_ACTIONS[] = {Player_Action::Up, Player_Action::Down, Player_Action::Left, Player_Action::Right,
+                                             Player_Action::Launch, Player_Action::Paint, Player_Action::ZoomIn, Player_Action::ZoomOut};
+
+    bool isOneShot(Player_Action action) {
+        return (actionBit(action) & Player_Input::OneShotBits) != 0;
+    }
+
+    void checkPlayerInput() {
+        Player_Input input;
+        for (Player_Action action : ALL_ACTIONS) {
+            CHECK(!input.has(action));
+            input.set(action, true);
+            CHECK(input.has(action));
+        }
+        CHECK(input.bits == 0xFF);
+        input.set(Player_Action::Left, false);
+        CHECK(!input.has(Player_Action::Left));
+        CHECK(input.has(Player_Action::Right));
+
+        CHECK(isOneShot(Player_Action::Launch) && isOneShot(Player_Action::Paint));
+        CHECK(isOneShot(Player_Action::ZoomIn) && isOneShot(Player_Action::ZoomOut));
+        CHECK(!isOneShot(Player_Action::Up) && !isOneShot(Player_Action::Down));
+        CHECK(!isOneShot(Player_Action::Left) && !isOneShot(Player_Action::Right));
+    }
+
+    // Each player owns one byte; writing one never disturbs another.
+    void checkInputWordPacking() {
+        Input_Word word = 0;
+        for (int player = 0; player < Input_Words::MaxPlayers; ++player) {
+            word = Input_Words::set(word, player, Player_Input{static_cast<std::uint8_t>(0x11 * (player + 1))});
+        }
+        CHECK(word == 0x8877665544332211ull);
+        for (int player = 0; player < Input_Words::MaxPlayers; ++player) {
+            CHECK(Input_Words::get(word, player).bits == 0x11 * (player + 1));
+        }
+
+        word = Input_Words::set(word, 3, Player_Input{0xFF});
+        CHECK(word == 0x88776655FF332211ull);
+        word = Input_Words::set(word, 7, Player_Input{0});
+        CHECK(word == 0x00776655FF332211ull);
+
+        // Clearing the one-shot bits leaves every player's held bits alone.
+        Input_Word all = ~Input_Word{0};
+        Input_Word held = Input_Words::clear(all, Player_Input::OneShotBits);
+        for (int player = 0; player < Input_Words::MaxPlayers; ++player) {
+            Player_Input input = Input_Words::get(held, player);
+            for (Player_Action action : ALL_ACTIONS) {
+                CHECK(input.has(action) != isOneShot(action));
+            }
+        }
+    }
+
+    // Held actions follow the key; one-shot ones latch on press, ignore the
+    // release and last until cleared, so a tap shorter than a step is seen.
+    void checkKeyBindings() {
+        Key_Bindings bindings = Key_Bindings::Default();
+        Input_Word word = 0;
+
+        bindings.apply(word, Key::W, true);
+        CHECK(Input_Words::get(word, 0).has(Player_Action::Up));
+        bindings.apply(word, Key::W, false);
+        CHECK(word == 0);
+
+        bindings.apply(word, Key::Space, true);
+        bindings.apply(word, Key::Space, false);
+        CHECK(Input_Words::get(word, 0).has(Player_Action::Paint));
+        bindings.apply(word, Key::Left, true);
+        word = Input_Words::clear(word, Player_Input::OneShotBits);
+        CHECK(!Input_Words::get(word, 0).has(Player_Action::Paint));
+        CHECK(Input_Words::get(word, 1).has(Player_Action::Left));
+        bindings.apply(word, Key::Left, false);
+        CHECK(word == 0);
+
+        // Every default player gets all eight actions, each on its own key.
+        Key defaults[4][8] = {
+            {Key::W, Key::S, Key::A, Key::D, Key::E, Key::Space, Key::Z, Key::X},
+            {Key::Up, Key::Down, Key::Left, Key::Right, Key::RShift, Key::RControl, Key::O, Key::P},
+            {Key::I, Key::K, Key::J, Key::L, Key::U, Key::Y, Key::N, Key::M},
+            {Key::Numpad8, Key::Numpad5, Key::Numpad4, Key::Numpad6, Key::Numpad7, Key::Numpad9, Key::Add, Key::Subtract}
+        };
+        for (int player = 0; player < 4; ++player) {
+            for (int action = 0; action < 8; ++action) {
+                Input_Word pressed = 0;
+                bindings.apply(pressed, defaults[player][action], true);
+                CHECK(pressed == Input_Words::set(0, player, Player_Input{actionBit(ALL_ACTIONS[action])}));
+            }
+        }
+
+        // Unbound keys and keys outside the table do nothing.
+        bindings.apply(word, Key::Q, true);
+        bindings.apply(word, Key::Unknown, true);
+        CHECK(word == 0);
+
+        bindings.bind(Key::W, 7, Player_Action::Launch);
+        bindings.apply(word, Key::W, true);
+        CHECK(word == Input_Words::set(0, 7, Player_Input{actionBit(Player_Action::Launch)}));
+        bindings.unbind(Key::W);
+        word = 0;
+        bindings.apply(word, Key::W, true);
+        CHECK(word == 0);
+
+        bool threw = false;
+        try {
+            bindings.bind(Key::W, Input_Words::MaxPlayers, Player_Action::Up);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        CHECK(threw);
+        threw = false;
+        try {
+            bindings.bind(Key::Unknown, 0, Player_Action::Up);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+}
+
+int main() {
+    checkPlayerInput();
+    checkInputWordPacking();
+    checkKeyBindings();
+    return Test_Check::result("Input_Test");
+}
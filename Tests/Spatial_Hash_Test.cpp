@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../Simulation/Spatial_Hash.h"
+#include "Test_Check.h"
+
+namespace {
+    constexpr float CELL_SIZE = 64.0f;
+
+    int cellOf(float value) {
+        return static_cast<int>(std::floor(value / CELL_SIZE));
+    }
+
+    // Every entry whose cell overlaps the area must be reported at least
+    // once, and nothing outside the table may be.
+    void checkQueriesAgainstBruteForce(std::uint32_t seed, std::size_t count) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coordinate(-500.0f, 3000.0f);
+        std::vector<sf::Vector2f> positions(count);
+        for (sf::Vector2f& position : positions) {
+            position = {coordinate(rng), coordinate(rng)};
+        }
+
+        Spatial_Hash hash(CELL_SIZE);
+        hash.build(positions.size(), [&](std::size_t i) { return positions[i]; });
+
+        std::uniform_real_distribution<float> extent(0.0f, 300.0f);
+        for (int query = 0; query < 200; ++query) {
+            sf::FloatRect area({coordinate(rng), coordinate(rng)}, {extent(rng), extent(rng)});
+            std::vector<int> visits(count, 0);
+            bool inRange = true;
+            hash.query(area, [&](std::uint32_t i) {
+                if (i < count) {
+                    ++visits[i];
+                } else {
+                    inRange = false;
+                }
+            });
+            CHECK(inRange);
+
+            int minX = cellOf(area.position.x), maxX = cellOf(area.position.x + area.size.x);
+            int minY = cellOf(area.position.y), maxY = cellOf(area.position.y + area.size.y);
+            for (std::size_t i = 0; i < count; ++i) {
+                int cellX = cellOf(positions[i].x), cellY = cellOf(positions[i].y);
+                bool overlaps = cellX >= minX && cellX <= maxX && cellY >= minY && cellY <= maxY;
+                if (overlaps) {
+                    CHECK(visits[i] >= 1);
+                }
+            }
+        }
+    }
+
+    // Within one bucket, entries come out in index order.
+    void checkBucketOrder() {
+        std::vector<sf::Vector2f> positions = {{10.0f, 10.0f}, {20.0f, 20.0f}, {30.0f, 30.0f}, {40.0f, 40.0f}};
+        Spatial_Hash hash(CELL_SIZE);
+        hash.build(positions.size(), [&](std::size_t i) { return positions[i]; });
+        std::vector<std::uint32_t> seen;
+        hash.query(sf::FloatRect({0.0f, 0.0f}, {1.0f, 1.0f}), [&](std::uint32_t i) { seen.push_back(i); });
+        CHECK((seen == std::vector<std::uint32_t>{0, 1, 2, 3}));
+    }
+
+    // A query spanning more cells than there are buckets visits some bucket
+    // twice, so a lone entry is reported more than once; callers rely on
+    // their exact test, and Simulation on its hit flags, to cope with that.
+    void checkDuplicateCandidates() {
+        std::vector<sf::Vector2f> positions = {{100.0f, 100.0f}};
+        Spatial_Hash hash(CELL_SIZE);
+        hash.build(positions.size(), [&](std::size_t i) { return positions[i]; });
+        int visits = 0;
+        hash.query(sf::FloatRect({0.0f, 0.0f}, {CELL_SIZE * 40.0f, CELL_SIZE * 40.0f}), [&](std::uint32_t) { ++visits; });
+        CHECK(visits > 1);
+    }
+
+    // Rebuilding with fewer entries must not report stale ones, and an
+    // empty build reports nothing.
+    void checkRebuild() {
+        std::vector<sf::Vector2f> positions(1000, {100.0f, 100.0f});
+        Spatial_Hash hash(CELL_SIZE);
+        hash.reserve(positions.size());
+        hash.build(positions.size(), [&](std::size_t i) { return positions[i]; });
+        hash.build(3, [&](std::size_t i) { return positions[i]; });
+        std::uint32_t largest = 0;
+        int visits = 0;
+        hash.query(sf::FloatRect({90.0f, 90.0f}, {20.0f, 20.0f}), [&](std::uint32_t i) { largest = std::max(largest, i); ++visits; });
+        CHECK(visits == 3);
+        CHECK(largest == 2);
+
+        hash.build(0, [&](std::size_t i) { return positions[i]; });
+        visits = 0;
+        hash.query(sf::FloatRect({0.0f, 0.0f}, {1000.0f, 1000.0f}), [&](std::uint32_t) { ++visits; });
+        CHECK(visits == 0);
+    }
+}
+
+int main() {
+    checkQueriesAgainstBruteForce(1, 1);
+    checkQueriesAgainstBruteForce(2, 37);
+    checkQueriesAgainstBruteForce(3, 5000);
+    checkBucketOrder();
+    checkDuplicateCandidates();
+    checkRebuild();
+    return Test_Check::result("Spatial_Hash_Test");
+}
@@ -0,0 +1,32 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <iostream>
+
+// Just enough for the test executables: CHECK reports a failed expression
+// with its location and carries on, and main returns Test_Check::result(),
+// which is what ctest looks at.
+namespace Test_Check {
+    inline int& failures() {
+        static int count = 0;
+        return count;
+    }
+
+    inline void fail(const char* expression, const char* file, int line) {
+        std::cerr << file << ':' << line << ": CHECK(" << expression << ") failed" << std::endl;
+        ++failures();
+    }
+
+    inline int result(const char* testName) {
+        if (failures() == 0) {
+            std::cout << testName << ": passed" << std::endl;
+            return 0;
+        }
+        std::cerr << testName << ": " << failures() << " checks failed" << std::endl;
+        return 1;
+    }
+}
+
+#define CHECK(expression) ((expression) ? static_cast<void>(0) : Test_Check::fail(#expression, __FILE__, __LINE__))
+
+#endif // TEST_CHECK_H
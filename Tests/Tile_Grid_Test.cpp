@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "../Arena/Tile_Grid.h"
+#include "Test_Check.h"
+
+namespace {
+    // Odds high enough that most spans cross special tiles.
+    const Tile_Odds ODDS = {0.05f, 0.1f, 0.1f, 0.05f, 0.05f};
+
+    bool sameChange(const Tile_Change& a, const Tile_Change& b) {
+        return a.tileIndex == b.tileIndex && a.ownerID == b.ownerID && a.baseColor == b.baseColor &&
+               a.ownerViewColor == b.ownerViewColor;
+    }
+
+    // The per-tile path Simulation::claimTile takes.
+    std::size_t claimEachTile(Tile_Grid& grid, const std::vector<Tile_Span>& spans, int playerID, sf::Color color,
+                              std::vector<Tile_Change>& changes) {
+        std::size_t changed = 0;
+        for (const Tile_Span& span : spans) {
+            for (int x = span.x0; x <= span.x1; ++x) {
+                std::size_t tileIndex = grid.index(x, span.y);
+                if (grid.claim(tileIndex, playerID, color)) {
+                    changes.push_back({tileIndex, playerID, grid.getBaseColor(tileIndex), grid.getDrawColor(tileIndex, playerID)});
+                    ++changed;
+                }
+            }
+        }
+        return changed;
+    }
+
+    // Random strokes of up to eight rows, some rows crossing page edges and
+    // the ragged last page, some overlapping each other, by up to eight
+    // players, unclaims, and repeat claims in the same or a new color, must
+    // leave both grids, their counts and the reported changes identical.
+    void checkSpansMatchPerTileClaims(int width, int height, std::uint32_t seed) {
+        Tile_Grid spans(width, height, seed, ODDS);
+        Tile_Grid tiles(width, height, seed, ODDS);
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> row(0, height - 1);
+        std::uniform_int_distribution<int> column(0, width - 1);
+        std::uniform_int_distribution<int> player(-1, 8);
+        std::uniform_int_distribution<int> rows(0, 8);
+        const sf::Color colors[] = {sf::Color::Blue, sf::Color::Cyan, sf::Color(255, 140, 0)};
+
+        bool sameResults = true;
+        for (int stroke = 0; stroke < 2000; ++stroke) {
+            std::vector<Tile_Span> strokeSpans;
+            for (int i = rows(rng); i > 0; --i) {
+                int x0 = column(rng);
+                int x1 = std::min(width - 1, x0 + static_cast<int>(rng() % (stroke % 10 == 0 ? width : 12)));
+                strokeSpans.push_back({row(rng), x0, x1});
+            }
+            if (stroke % 7 == 0 && !strokeSpans.empty()) {
+                strokeSpans.push_back(strokeSpans.front());
+            }
+            int playerID = player(rng);
+            sf::Color color = colors[rng() % 3];
+
+            std::vector<Tile_Change> spanChanges, tileChanges;
+            std::size_t spanChanged = spans.claimSpans(strokeSpans, playerID, color, spanChanges);
+            std::size_t tileChanged = claimEachTile(tiles, strokeSpans, playerID, color, tileChanges);
+            bool same = spanChanged == tileChanged && spanChanges.size() == tileChanges.size();
+            for (std::size_t i = 0; same && i < spanChanges.size(); ++i) {
+                same = sameChange(spanChanges[i], tileChanges[i]);
+            }
+            for (int owner = 0; owner <= 8; ++owner) {
+                same = same && spans.getOwnedCount(owner) == tiles.getOwnedCount(owner);
+            }
+            sameResults = sameResults && same;
+        }
+        CHECK(sameResults);
+
+        bool sameOwners = true;
+        for (std::size_t i = 0; i < spans.size(); ++i) {
+            sameOwners = sameOwners && spans.getOwner(i) == tiles.getOwner(i) && spans.getBaseColor(i) == tiles.getBaseColor(i);
+        }
+        CHECK(sameOwners);
+        CHECK(spans.getAllocatedPages() == tiles.getAllocatedPages());
+    }
+
+    // A stroke already owned in the same color changes nothing, and one
+    // taking tiles from two owners moves all the counts at once.
+    void checkStrokeCounts() {
+        Tile_Grid grid(100, 100, 3, ODDS);
+        std::vector<Tile_Change> changes;
+        CHECK(grid.claimSpans({{70, 10, 90}}, 2, sf::Color::Blue, changes) == 81);
+        CHECK(grid.claimSpans({{71, 10, 19}}, 4, sf::Color::Red, changes) == 10);
+        CHECK(grid.getOwnedCount(2) == 81);
+        changes.clear();
+        CHECK(grid.claimSpans({{70, 10, 90}, {70, 20, 30}}, 2, sf::Color::Blue, changes) == 0);
+        CHECK(changes.empty());
+        CHECK(grid.claimSpans({{70, 50, 60}, {71, 15, 24}, {70, 55, 65}}, 3, sf::Color::Cyan, changes) == 26);
+        CHECK(grid.getOwnedCount(2) == 65);
+        CHECK(grid.getOwnedCount(3) == 26);
+        CHECK(grid.getOwnedCount(4) == 5);
+    }
+}
+
+int main() {
+    checkSpansMatchPerTileClaims(64, 64, 1);
+    checkSpansMatchPerTileClaims(150, 130, 2);
+    checkSpansMatchPerTileClaims(300, 40, 3);
+    checkStrokeCounts();
+    return Test_Check::result("Tile_Grid_Test");
+}
@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+#include "../Balloon.h"
+#include "../Simulation/Timer_Wheel.h"
+#include "Test_Check.h"
+
+namespace {
+    // Every timer fires exactly on its due tick, whichever level it starts
+    // on, including due ticks right at and past each level boundary.
+    void checkCascading() {
+        std::vector<Sim_Time::Tick> dues = {1, 2, 255, 256, 257, 511, 512, 65535, 65536, 65537, 70000,
+                                            16777215, 16777216, 16777217, 16777216 + 300};
+        Timer_Wheel wheel;
+        for (std::size_t i = 0; i < dues.size(); ++i) {
+            wheel.schedule(dues[i], 0, i);
+        }
+        std::vector<Sim_Time::Tick> firedAt(dues.size(), 0);
+        int fired = 0;
+        // Uneven jumps, so some cascades happen in the middle of an advance.
+        for (Sim_Time::Tick now = 0; now < dues.back() + 97; now += 97) {
+            wheel.advance(now, [&](std::uint64_t payload) {
+                firedAt[payload] = wheel.getCurrentTick();
+                ++fired;
+            });
+        }
+        CHECK(fired == static_cast<int>(dues.size()));
+        for (std::size_t i = 0; i < dues.size(); ++i) {
+            CHECK(firedAt[i] == dues[i]);
+        }
+        CHECK(wheel.size() == 0);
+    }
+
+    // Random dues scheduled while the wheel is already running, against the
+    // tick each should fire on. A due tick the wheel has already passed
+    // fires on the next one.
+    void checkAgainstReference() {
+        std::mt19937 rng(5);
+        std::uniform_int_distribution<Sim_Time::Tick> delay(0, 200000);
+        Timer_Wheel wheel;
+        std::vector<Sim_Time::Tick> expected;
+        std::vector<Sim_Time::Tick> firedAt;
+        Sim_Time::Tick lastFired = 0;
+        bool inOrder = true;
+        for (Sim_Time::Tick now = 0; now < 500000; now += 1 + now % 300) {
+            if (now < 250000) {
+                Sim_Time::Tick due = now + delay(rng) - (expected.size() % 7 == 0 ? now : 0);
+                Sim_Time::Tick current = wheel.getCurrentTick();
+                wheel.schedule(due, 0, expected.size());
+                expected.push_back(due > current ? due : current + 1);
+                firedAt.push_back(0);
+            }
+            wheel.advance(now, [&](std::uint64_t payload) {
+                firedAt[payload] = wheel.getCurrentTick();
+                inOrder = inOrder && wheel.getCurrentTick() >= lastFired;
+                lastFired = wheel.getCurrentTick();
+            });
+        }
+        CHECK(inOrder);
+        CHECK(firedAt == expected);
+    }
+
+    // A callback may cancel a timer due on the same tick that has not fired
+    // yet, and may reuse its slot for a new timer straight away.
+    void checkCancelWhileFiring() {
+        Timer_Wheel wheel;
+        std::vector<Timer_Handle> handles;
+        for (std::uint64_t i = 0; i < 4; ++i) {
+            handles.push_back(wheel.schedule(10, 0, i));
+        }
+        std::vector<std::uint64_t> fired;
+        Timer_Handle replacement;
+        wheel.advance(10, [&](std::uint64_t payload) {
+            fired.push_back(payload);
+            if (fired.size() == 1) {
+                for (const Timer_Handle& handle : handles) {
+                    wheel.cancel(handle);
+                }
+                replacement = wheel.schedule(10, 0, 99);
+            }
+        });
+        CHECK(fired.size() == 1);
+        CHECK(wheel.isActive(replacement));
+        CHECK(wheel.size() == 1);
+
+        fired.clear();
+        wheel.advance(11, [&](std::uint64_t payload) { fired.push_back(payload); });
+        CHECK((fired == std::vector<std::uint64_t>{99}));
+        CHECK(wheel.size() == 0);
+    }
+
+    // A handle goes stale once its timer fires or is cancelled, and stays
+    // stale after the slot is reused.
+    void checkStaleHandles() {
+        Timer_Wheel wheel;
+        Timer_Handle first = wheel.schedule(5, 0, 1);
+        CHECK(wheel.isActive(first));
+        wheel.advance(5, [](std::uint64_t) {});
+        CHECK(!wheel.isActive(first));
+        CHECK(!wheel.cancel(first));
+
+        Timer_Handle second = wheel.schedule(20, 0, 2);
+        CHECK(second.index == first.index);
+        CHECK(second.generation != first.generation);
+        CHECK(!wheel.cancel(first));
+        wheel.setPayload(first, 7);
+        CHECK(wheel.isActive(second));
+
+        CHECK(wheel.cancel(second));
+        CHECK(!wheel.cancel(second));
+        CHECK(!wheel.isActive(Timer_Handle{}));
+        CHECK(!wheel.cancel(Timer_Handle{}));
+
+        Timer_Handle third = wheel.schedule(30, 0, 3);
+        wheel.setPayload(second, 8);
+        std::vector<std::uint64_t> fired;
+        wheel.advance(40, [&](std::uint64_t payload) { fired.push_back(payload); });
+        CHECK((fired == std::vector<std::uint64_t>{3}));
+        CHECK(!wheel.isActive(third));
+    }
+
+    // A periodic timer re-arms itself every period, across level boundaries,
+    // until it cancels itself from its own callback.
+    void checkPeriodic() {
+        Timer_Wheel wheel;
+        Timer_Handle handle = wheel.schedule(50, 300, 1);
+        std::vector<Sim_Time::Tick> firedAt;
+        wheel.advance(2000, [&](std::uint64_t) {
+            firedAt.push_back(wheel.getCurrentTick());
+            if (firedAt.size() == 5) {
+                CHECK(wheel.cancel(handle));
+            }
+        });
+        CHECK((firedAt == std::vector<Sim_Time::Tick>{50, 350, 650, 950, 1250}));
+        CHECK(!wheel.isActive(handle));
+        CHECK(wheel.size() == 0);
+    }
+
+    // Balloon expiry timers carry their balloon's slot. Removing a balloon
+    // swaps the last one into its slot, so the moved balloon's timer has to
+    // be retargeted, as Simulation does; every expiry must then still name
+    // the slot of the balloon it was scheduled for.
+    void checkRetargetOnSwapRemove() {
+        Balloon_Pool pool(512);
+        Timer_Wheel wheel;
+        std::map<int, Sim_Time::Tick> dueOf;
+        std::mt19937 rng(9);
+        std::uniform_int_distribution<Sim_Time::Tick> lifespan(1, 600);
+        auto removeBalloon = [&](std::size_t i) {
+            wheel.cancel(pool.getExpiryTimer(i));
+            if (pool.remove(i)) {
+                wheel.setPayload(pool.getExpiryTimer(i), i);
+            }
+        };
+
+        int nextBalloon = 0;
+        bool namesRightSlot = true;
+        int expired = 0;
+        for (Sim_Time::Tick now = 0; now < 3000; ++now) {
+            std::vector<std::uint64_t> due;
+            wheel.advance(now, [&](std::uint64_t payload) { due.push_back(payload); });
+            // Back to front, so a balloon swapped down is never one still to go.
+            std::sort(due.begin(), due.end(), std::greater<std::uint64_t>());
+            for (std::uint64_t i : due) {
+                namesRightSlot = namesRightSlot && i < pool.size() && dueOf[pool.getOwnerID(i)] == now;
+                removeBalloon(i);
+                ++expired;
+            }
+            if (now < 2000 && !pool.full()) {
+                Sim_Time::Tick expiry = now + lifespan(rng);
+                Timer_Handle handle = wheel.schedule(expiry, 0, pool.size());
+                dueOf[nextBalloon] = expiry;
+                pool.spawn(sf::Color::Red, {}, nextBalloon++, -1, {}, handle);
+            }
+            // Pop some balloons early, as hits do.
+            if (now % 3 == 0 && !pool.empty()) {
+                removeBalloon(rng() % pool.size());
+            }
+        }
+        CHECK(namesRightSlot);
+        CHECK(expired > 0);
+        CHECK(pool.empty());
+        CHECK(wheel.size() == 0);
+    }
+}
+
+int main() {
+    checkCascading();
+    checkAgainstReference();
+    checkCancelWhileFiring();
+    checkStaleHandles();
+    checkPeriodic();
+    checkRetargetOnSwapRemove();
+    return Test_Check::result("Timer_Wheel_Test");
+}
@@ -2,8 +2,7 @@
 #define UI_ELEMENTS_H
 
 #include <SFML/Graphics.hpp>
-class Player;
-class Arena;
+#include <vector>
 
 namespace UIConstants {
     constexpr float HEALTH_BAR_WIDTH = 200.0f;
@@ -20,34 +19,51 @@ namespace UIConstants {
     constexpr unsigned int WIN_MESSAGE_TEXT_SIZE = 52;
 }
 
+// HUD driven by change notifications. Each on...Changed call compares the
+// new value with the last one and only marks the affected bars dirty; draw
+// rebuilds dirty geometry and text, so unchanged frames only issue draws.
+// Every player gets a health bar in their own viewport and a segment of
+// the shared ownership bar.
 class UI_Elements {
 public:
     explicit UI_Elements(const sf::Font& font);
 
-    void update(unsigned int windowWidth, unsigned int windowHeight,
-                const Player& player1, const Player& player2,
-                const Arena& arena);
+    // One entry per player; viewports are fractions of the window, as in sf::View.
+    void setPlayers(const std::vector<sf::Color>& colors, const std::vector<sf::FloatRect>& viewports);
+    void onWindowResized(unsigned int windowWidth, unsigned int windowHeight);
+    void onHealthChanged(int playerIndex, unsigned int health);
+    void onOwnershipChanged(int playerIndex, int owned, int totalPlayableTiles);
 
     void draw(sf::RenderWindow& window);
 
 private:
-    sf::Font m_font;
-    sf::RectangleShape m_player1HealthBarBackground;
-    sf::RectangleShape m_player1HealthBarGreen;
-    sf::RectangleShape m_player1HealthBarRed;
-    sf::Text m_player1HealthText;
+    struct Player_HUD {
+        sf::FloatRect viewport;
+        sf::RectangleShape healthBarBackground;
+        sf::RectangleShape healthBarGreen;
+        sf::RectangleShape healthBarRed;
+        sf::Text healthText;
+        sf::RectangleShape ownershipBar;
+        sf::Text percentageText;
+        unsigned int health = 100;
+        int owned = 0;
+        int percent = -1;
+        bool healthDirty = true;
+
+        Player_HUD(const sf::Font& font, int playerNumber, sf::Color color, sf::FloatRect viewport);
+    };
 
-    sf::RectangleShape m_player2HealthBarBackground;
-    sf::RectangleShape m_player2HealthBarGreen;
-    sf::RectangleShape m_player2HealthBarRed;
-    sf::Text m_player2HealthText;
+    void layoutHealth(Player_HUD& hud);
+    void layoutOwnership();
 
+    sf::Font m_font;
+    std::vector<Player_HUD> m_players;
     sf::RectangleShape m_ownershipBarBackground;
-    sf::RectangleShape m_player1OwnershipBar;
-    sf::RectangleShape m_player2OwnershipBar;
-    sf::Text m_player1PercentageText;
-    sf::Text m_player2PercentageText;
 
+    unsigned int m_windowWidth = 0;
+    unsigned int m_windowHeight = 0;
+    int m_totalPlayableTiles = 0;
+    bool m_ownershipDirty = true;
 };
 
-#endif // UI_ELEMENTS_H
\ No newline at end of file
+#endif // UI_ELEMENTS_H